@@ -0,0 +1,190 @@
+#ifndef CGAL_TUTORIAL_BATCH_HULLS_H
+#define CGAL_TUTORIAL_BATCH_HULLS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
+// part-iv.cpp computes the hull of five points with CGAL::convex_hull_2()
+// into a std::vector through a back_inserter. That is fine once, but with
+// millions of such hulls per second the allocations dominate: the vector
+// grows, and CGAL::ch_graham_andrew() copies the points into a vector of its
+// own. batch_convex_hull_2() computes the hulls of a whole batch of small
+// point sets without a single allocation per hull.
+//
+// The sets come in CSR form, one array with all the points and an array of
+// offsets: set i is points[offsets[i], offsets[i + 1]). The hulls are written
+// the same way, to an output array with room for as many points as the
+// input, and an array of n_sets + 1 output offsets:
+//
+//    std::vector<Point_2> hulls(points.size());
+//    std::vector<std::size_t> hull_offsets(n_sets + 1);
+//    batch_convex_hull_2(points.data(), offsets.data(), n_sets,
+//                        hulls.data(), hull_offsets.data(), Kernel());
+//
+// Each thread sorts a copy of its set and runs the two scans of
+// CGAL::ch_graham_andrew() over it, with the copy and the stack in a
+// BumpArena that is reset for every hull and only grows when a set is larger
+// than any before. The hull goes to the output at the offset of its set.
+// Once all the hulls are known, a prefix sum gives the output offsets, and
+// one pass moves the hulls together. With TBB the sets are spread over the
+// threads by tbb::parallel_for, each with an arena of its own.
+//
+// Each hull is the same as that of CGAL::ch_graham_andrew(). Only
+// Less_xy_2, Left_turn_2 and Equal_2 of the traits are used.
+
+// Memory for the scratch arrays of one hull at a time: allocate() hands out
+// consecutive pieces of one buffer, and reset() takes them all back.
+template <typename T>
+class BumpArena {
+public:
+
+    // Takes back everything allocated so far, and makes sure that the next
+    // allocations of up to capacity elements fit.
+    void
+    reset(std::size_t capacity) {
+        _used = 0;
+        if (_buffer.size() < capacity) {
+            _buffer.resize(std::max(capacity, 2 * _buffer.size()));
+        }
+    }
+
+    T *
+    allocate(std::size_t n) {
+        T *p = _buffer.data() + _used;
+        _used += n;
+        return p;
+    }
+
+private:
+    std::vector<T> _buffer;
+    std::size_t _used = 0;
+};
+
+namespace batch_hulls_internal {
+
+    // Sets up to this many are handed to a thread at once.
+    constexpr std::size_t grain_size = 256;
+
+    // One chain of the Graham-Andrew scan, as in CGAL::ch_graham_andrew(),
+    // over the sorted points [first, last), whose ends differ: writes the
+    // chain from *first up to, but without, *(last - 1) to result, using
+    // stack for up to last - first + 1 points. A point is only tried if it
+    // is strictly right of the line from the top of the stack to the last
+    // point, which spares most points the popping loop.
+    template <typename Iterator, typename Point, typename Traits>
+    Point *
+    scan(Iterator first, Iterator last, Point *stack, Point *result,
+         const Traits &traits) {
+        auto left_turn = traits.left_turn_2_object();
+        const Point &west = *first, &east = *(last - 1);
+        std::size_t size = 0;
+        stack[size++] = east;
+        stack[size++] = west;
+        Iterator it = first + 1;
+        while (it != last - 1 && !left_turn(east, west, *it)) {
+            ++it;
+        }
+        if (it != last - 1) {
+            stack[size++] = *it;
+            while (++it != last - 1) {
+                if (left_turn(stack[size - 1], *it, east)) {
+                    while (!left_turn(stack[size - 2], stack[size - 1], *it)) {
+                        --size;
+                    }
+                    stack[size++] = *it;
+                }
+            }
+        }
+        return std::copy(stack + 1, stack + size, result);
+    }
+
+    // Writes the hull of [first, first + n) to result and returns its size,
+    // which is at most n.
+    template <typename Point, typename Traits>
+    std::size_t
+    graham_andrew(const Point *first, std::size_t n, Point *result,
+                  BumpArena<Point> &arena, const Traits &traits) {
+        if (n == 0) {
+            return 0;
+        }
+        arena.reset(2 * n + 1);
+        Point *points = arena.allocate(n);
+        Point *stack = arena.allocate(n + 1);
+        std::copy(first, first + n, points);
+        std::sort(points, points + n, traits.less_xy_2_object());
+        if (traits.equal_2_object()(points[0], points[n - 1])) {
+            result[0] = points[0];
+            return 1;
+        }
+        // The lower chain from the smallest point to the largest, and the
+        // upper chain back.
+        Point *end = scan(points, points + n, stack, result, traits);
+        end = scan(std::make_reverse_iterator(points + n),
+                   std::make_reverse_iterator(points), stack, end, traits);
+        return static_cast<std::size_t>(end - result);
+    }
+
+}
+
+// Writes the hulls of the n_sets point sets points[offsets[i], offsets[i + 1])
+// to hulls, the hull of set i at hulls[hull_offsets[i], hull_offsets[i + 1]).
+// hulls must have room for offsets[n_sets] - offsets[0] points, and
+// hull_offsets for n_sets + 1 offsets.
+template <typename Point, typename Traits>
+void
+batch_convex_hull_2(const Point *points, const std::size_t *offsets,
+                    std::size_t n_sets, Point *hulls,
+                    std::size_t *hull_offsets, const Traits &traits) {
+    using batch_hulls_internal::graham_andrew;
+    if (n_sets == 0) {
+        hull_offsets[0] = 0;
+        return;
+    }
+
+    // The hull of set i goes to the position of the set, and its size to
+    // hull_offsets[i + 1].
+    const std::size_t base = offsets[0];
+    auto compute = [&](std::size_t first, std::size_t last,
+                       BumpArena<Point> &arena) {
+        for (std::size_t i = first; i < last; ++i) {
+            hull_offsets[i + 1] = graham_andrew(
+                points + offsets[i], offsets[i + 1] - offsets[i],
+                hulls + (offsets[i] - base), arena, traits);
+        }
+    };
+#ifdef CGAL_LINKED_WITH_TBB
+    tbb::enumerable_thread_specific<BumpArena<Point>> arenas;
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, n_sets,
+                                        batch_hulls_internal::grain_size),
+        [&](const tbb::blocked_range<std::size_t> &sets) {
+            compute(sets.begin(), sets.end(), arenas.local());
+        });
+#else
+    BumpArena<Point> arena;
+    compute(0, n_sets, arena);
+#endif
+
+    // The hulls only move towards the front, so moving them in order never
+    // overwrites one that has not moved yet.
+    hull_offsets[0] = 0;
+    for (std::size_t i = 0; i < n_sets; ++i) {
+        const std::size_t size = hull_offsets[i + 1];
+        const std::size_t from = offsets[i] - base;
+        hull_offsets[i + 1] = hull_offsets[i] + size;
+        if (from != hull_offsets[i]) {
+            std::copy(hulls + from, hulls + from + size,
+                      hulls + hull_offsets[i]);
+        }
+    }
+}
+
+#endif //CGAL_TUTORIAL_BATCH_HULLS_H
@@ -0,0 +1,106 @@
+// Computes the hulls of a batch of small point sets, 5 to 50 points each as
+// in part-iv.cpp, one CGAL::convex_hull_2() call per set into a fresh
+// std::vector, and with batch_convex_hull_2() (see batch_hulls.h) with 1, 2,
+// 4, ... threads, and reports hulls per second. Every batch hull is checked
+// against CGAL::ch_graham_andrew().
+//
+// usage: bench-batch-hulls [n_sets]
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include "batch_hulls.h"
+#include "bench_util.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+int main(int argc, char *argv[]) {
+
+    auto n_sets = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+
+    // The sets, in CSR form.
+    std::mt19937_64 gen(7);
+    std::uniform_int_distribution<std::size_t> set_size(5, 50);
+    std::vector<std::size_t> offsets{0};
+    for (std::size_t i = 0; i < n_sets; ++i) {
+        offsets.push_back(offsets.back() + set_size(gen));
+    }
+    auto points = random_points<Point_2>(Distribution::uniform_disk,
+                                         offsets.back());
+    std::cout << n_sets << " sets, " << points.size() << " points"
+              << std::endl;
+
+    std::size_t n_hull_points = 0;
+    double vector_t = best_seconds(3, [&] {
+        n_hull_points = 0;
+        for (std::size_t i = 0; i < n_sets; ++i) {
+            std::vector<Point_2> hull;
+            CGAL::convex_hull_2(points.begin() + offsets[i],
+                                points.begin() + offsets[i + 1],
+                                std::back_inserter(hull));
+            n_hull_points += hull.size();
+        }
+    });
+    std::cout << "  convex_hull_2 per set:       " << n_sets / vector_t * 1e-6
+              << " M hulls/s (" << n_hull_points << " hull points)"
+              << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    const unsigned max_threads =
+        std::max(1u, std::thread::hardware_concurrency());
+#else
+    const unsigned max_threads = 1;
+#endif
+
+    std::vector<Point_2> hulls(points.size());
+    std::vector<std::size_t> hull_offsets(n_sets + 1);
+    for (unsigned threads = 1;; threads = std::min(2 * threads, max_threads)) {
+#ifdef CGAL_LINKED_WITH_TBB
+        tbb::global_control control(
+            tbb::global_control::max_allowed_parallelism, threads);
+#endif
+        double t = best_seconds(3, [&] {
+            batch_convex_hull_2(points.data(), offsets.data(), n_sets,
+                                hulls.data(), hull_offsets.data(), Kernel());
+        });
+        std::cout << "  batch_convex_hull_2, " << threads << " thread"
+                  << (threads == 1 ? ": " : "s:") << "  "
+                  << n_sets / t * 1e-6 << " M hulls/s, "
+                  << vector_t / t << "x faster" << std::endl;
+        if (threads == max_threads) {
+            break;
+        }
+    }
+
+    std::size_t n_differ = 0;
+    std::vector<Point_2> expected;
+    for (std::size_t i = 0; i < n_sets; ++i) {
+        expected.clear();
+        CGAL::ch_graham_andrew(points.begin() + offsets[i],
+                               points.begin() + offsets[i + 1],
+                               std::back_inserter(expected));
+        if (!std::equal(expected.begin(), expected.end(),
+                        hulls.begin() + hull_offsets[i],
+                        hulls.begin() + hull_offsets[i + 1])) {
+            ++n_differ;
+        }
+    }
+    std::cout << "  hulls " << (n_differ == 0 ? "identical" : "DIFFER")
+              << std::endl;
+
+    return 0;
+
+}
@@ -0,0 +1,138 @@
+// Measures the hull of points on the unit circle, where nearly every point
+// is a hull vertex, with the O(h^2) loops that try every pair of vertices or
+// every edge against every vertex, and with CaliperHull (see caliper_hull.h):
+// once query by query and once with all queries in one sweep. Reports the
+// times and checks that the answers agree. The O(h^2) loops are skipped
+// above max_quadratic hull vertices.
+//
+// usage: bench-calipers [max_h] [max_quadratic]
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include "bench_util.h"
+#include "caliper_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::FT FT;
+typedef CaliperHull<Kernel> Hull;
+
+// What the O(h^2) loops find: the squared diameter and width, and the
+// smallest area and squared perimeter of a rectangle with a side on an edge.
+struct Quadratic_results {
+    FT squared_diameter = 0;
+    FT squared_width = 0;
+    FT area = 0;
+    FT squared_perimeter = 0;
+};
+
+Quadratic_results
+quadratic(const std::vector<Point_2> &hull) {
+    const std::size_t h = hull.size();
+    Quadratic_results r;
+    for (std::size_t i = 0; i < h; ++i) {
+        for (std::size_t j = i + 1; j < h; ++j) {
+            r.squared_diameter = std::max(
+                r.squared_diameter, CGAL::squared_distance(hull[i], hull[j]));
+        }
+    }
+    bool first = true;
+    for (std::size_t i = 0; i < h; ++i) {
+        const Point_2 &a = hull[i], &b = hull[(i + 1) % h];
+        const FT ex = b.x() - a.x(), ey = b.y() - a.y();
+        const FT length = ex * ex + ey * ey;
+        FT height = 0, low = 0, high = 0;
+        for (const Point_2 &c : hull) {
+            const FT cross = ex * (c.y() - a.y()) - ey * (c.x() - a.x());
+            const FT dot = ex * (c.x() - a.x()) + ey * (c.y() - a.y());
+            height = std::max(height, cross);
+            low = std::min(low, dot);
+            high = std::max(high, dot);
+        }
+        const FT width = height * height / length;
+        const FT area = (high - low) * height / length;
+        const FT perimeter =
+            4 * (high - low + height) * (high - low + height) / length;
+        r.squared_width = first ? width : std::min(r.squared_width, width);
+        r.area = first ? area : std::min(r.area, area);
+        r.squared_perimeter =
+            first ? perimeter : std::min(r.squared_perimeter, perimeter);
+        first = false;
+    }
+    return r;
+}
+
+bool
+close(FT a, FT b) {
+    return std::abs(a - b) <= 1e-9 * std::max(FT(1), std::abs(b));
+}
+
+int main(int argc, char *argv[]) {
+
+    auto max_h = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+    auto max_quadratic =
+        static_cast<std::size_t>(arg_or(argc, argv, 2, 20'000));
+
+    std::cout << "h\tO(h^2) s\tqueries one by one s\tone sweep s\tresults"
+              << std::endl;
+    for (std::size_t n = 100; n <= max_h; n *= 10) {
+        auto points = random_points<Point_2>(Distribution::on_circle, n);
+        Hull hull(points.begin(), points.end());
+
+        Hull::Results results;
+        double separate_t = best_seconds(3, [&] {
+            results.antipodal_pairs = hull.antipodal_pairs();
+            results.diameter = hull.diameter();
+            results.width = hull.width();
+            results.min_area_rectangle = hull.min_area_rectangle();
+            results.min_perimeter_rectangle = hull.min_perimeter_rectangle();
+        });
+        Hull::Results together;
+        double together_t = best_seconds(3, [&] {
+            together = hull.measure(Hull::ALL);
+        });
+        bool same =
+            together.antipodal_pairs == results.antipodal_pairs &&
+            together.diameter->squared_length ==
+                results.diameter->squared_length &&
+            together.width->squared_width == results.width->squared_width &&
+            together.min_area_rectangle->area ==
+                results.min_area_rectangle->area &&
+            together.min_perimeter_rectangle->squared_perimeter ==
+                results.min_perimeter_rectangle->squared_perimeter;
+
+        std::cout << hull.size() << "\t";
+        if (hull.size() <= max_quadratic) {
+            // Kept in a vector so that the loops are not moved out of the
+            // timed region: the compiler would otherwise see that nothing
+            // but the local result depends on them.
+            std::vector<Quadratic_results> runs;
+            double quadratic_t = best_seconds(3, [&] {
+                runs.push_back(quadratic(hull.points()));
+            });
+            const Quadratic_results &expected = runs.back();
+            same = same &&
+                   close(together.diameter->squared_length,
+                         expected.squared_diameter) &&
+                   close(together.width->squared_width,
+                         expected.squared_width) &&
+                   close(together.min_area_rectangle->area, expected.area) &&
+                   close(together.min_perimeter_rectangle->squared_perimeter,
+                         expected.squared_perimeter);
+            std::cout << quadratic_t;
+        } else {
+            std::cout << "-";
+        }
+        std::cout << "\t" << separate_t << "\t" << together_t << "\t"
+                  << (same ? "agree" : "DISAGREE") << std::endl;
+    }
+
+    return 0;
+
+}
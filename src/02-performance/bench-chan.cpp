@@ -0,0 +1,138 @@
+// Compares Chan's output-sensitive algorithm (see chan_hull.h) with the
+// CGAL::ch_graham_andrew(), CGAL::ch_akl_toussaint() and CGAL::ch_bykat()
+// hulls as the number h of hull points grows, for a fixed number of points.
+// The points are the h vertices of a regular polygon and random points inside
+// its inscribed disk, so the hull has exactly h points.
+//
+// We also run ch_chan() with the toy Traits of part-vii.cpp and with
+// CGAL::Projection_traits_yz_3, which only provide the predicates of the
+// ConvexHullTraits_2 concept listed in part-vi.cpp.
+//
+// usage: bench-chan [n_points]
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Projection_traits_yz_3.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "chan_hull.h"
+#include "toy_frac.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Projection_traits_yz_3<Kernel> Traits_yz;
+
+// n points, h of them the vertices of a regular polygon in the unit circle
+// and the others strictly inside it, as make_point(x, y).
+template <typename Point, typename MakePoint>
+std::vector<Point>
+polygon_points(std::size_t n, std::size_t h, MakePoint make_point) {
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    const double r = 0.999 * std::cos(std::numbers::pi / h);
+
+    std::vector<Point> points;
+    points.reserve(n);
+    for (std::size_t i = 0; i < h; ++i) {
+        double t = 2.0 * std::numbers::pi * i / h;
+        points.push_back(make_point(std::cos(t), std::sin(t)));
+    }
+    while (points.size() < n) {
+        double x = uniform(gen), y = uniform(gen);
+        if (x * x + y * y <= 1.0) {
+            points.push_back(make_point(r * x, r * y));
+        }
+    }
+    // Shuffled, so that the hull points do not all end up in one group.
+    std::shuffle(points.begin(), points.end(), gen);
+    return points;
+}
+
+template <typename Point, typename Hull>
+double
+time_hull(const std::vector<Point> &points, std::vector<Point> &hull,
+          Hull hull_function) {
+    return time_seconds([&] {
+        hull.clear();
+        hull_function(points.begin(), points.end(), std::back_inserter(hull));
+    });
+}
+
+template <typename Traits, typename Point>
+void
+check(const char *name, const std::vector<Point> &points) {
+    std::vector<Point> expected, hull;
+    double graham_andrew_t = time_hull(points, expected, [](auto... args) {
+        return CGAL::ch_graham_andrew(args..., Traits());
+    });
+    double chan_t = time_hull(points, hull, [](auto... args) {
+        return ch_chan(args..., Traits());
+    });
+    bool same = std::equal(hull.begin(), hull.end(), expected.begin(),
+                           expected.end(), Traits().equal_2_object());
+    std::cout << name << " (" << points.size() << " points, "
+              << expected.size() << " hull points): ch_graham_andrew "
+              << graham_andrew_t << " s, ch_chan " << chan_t << " s, hulls "
+              << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    std::cout << "EPICK, " << n << " points" << std::endl;
+    std::cout << "h\tgraham_andrew\takl_toussaint\tbykat\tchan\thulls"
+              << std::endl;
+    for (std::size_t h = 8; h <= n && h <= 32768; h *= 8) {
+        auto points = polygon_points<Point_2>(n, h, [](double x, double y) {
+            return Point_2(x, y);
+        });
+        std::vector<Point_2> expected, hull;
+        double graham_andrew_t = time_hull(points, expected,
+                                           [](auto... args) {
+            return CGAL::ch_graham_andrew(args...);
+        });
+        double akl_toussaint_t = time_hull(points, hull, [](auto... args) {
+            return CGAL::ch_akl_toussaint(args...);
+        });
+        double bykat_t = time_hull(points, hull, [](auto... args) {
+            return CGAL::ch_bykat(args...);
+        });
+        double chan_t = time_hull(points, hull, [](auto... args) {
+            return ch_chan(args...);
+        });
+        std::cout << expected.size() << "\t" << graham_andrew_t << "\t"
+                  << akl_toussaint_t << "\t" << bykat_t << "\t" << chan_t
+                  << "\t" << (hull == expected ? "identical" : "DIFFER")
+                  << std::endl;
+    }
+
+    // The toy fractions overflow on large components, so we keep them as
+    // small as in bench-frac.cpp, and the toy Traits are slow, so we use
+    // fewer points.
+    check<toy::Traits>("toy Traits", polygon_points<toy::FracPoint2>(
+        n / 10, 64, [](double x, double y) {
+            return toy::FracPoint2(toy::Frac(std::llround(x * 8000), 8),
+                                   toy::Frac(std::llround(y * 8000), 8));
+        }));
+
+    // The yz-projection of points whose x coordinate is noise.
+    std::mt19937_64 gen(7);
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+    check<Traits_yz>("Projection_traits_yz_3", polygon_points<Point_3>(
+        n, 64, [&](double y, double z) {
+            return Point_3(noise(gen), y, z);
+        }));
+
+    return 0;
+
+}
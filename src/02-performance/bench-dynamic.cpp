@@ -0,0 +1,134 @@
+// A fleet of moving points: starting from 1M live points, every update
+// either inserts a new point or deletes a random live one, with equal
+// probability. We compare DynamicHull (see dynamic_hull.h) with recomputing
+// CGAL::convex_hull_2() from all the live points after every change, and
+// check that the final hulls agree.
+//
+// Then the same for a sliding window: the points are sorted by x, and every
+// update inserts the next point on the right or deletes the oldest one on
+// the left, like a fleet moving through a region. All the changes fall in
+// the first and last buckets, which keep splitting and merging.
+//
+// usage: bench-dynamic [n_live_points] [n_updates]
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "dynamic_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+void
+bench(Distribution distribution, std::size_t n_live, std::size_t n_updates) {
+    // The initial points, followed by those that will be inserted.
+    auto points = random_points<Point_2>(distribution, n_live + n_updates);
+    std::vector<Point_2> live(points.begin(), points.begin() + n_live);
+    auto next = points.begin() + n_live;
+
+    std::vector<Point_2> hull;
+    double build_t = time_seconds([&] {
+        DynamicHull<Kernel> dynamic(live.begin(), live.end());
+        dynamic.hull(std::back_inserter(hull));
+    });
+
+    DynamicHull<Kernel> dynamic(live.begin(), live.end());
+    std::mt19937_64 gen(7);
+    std::size_t n_inserted = 0, n_erased = 0;
+    double update_t = time_seconds([&] {
+        for (std::size_t i = 0; i < n_updates; ++i) {
+            if (live.empty() || gen() % 2 == 0) {
+                dynamic.insert(*next);
+                live.push_back(*next++);
+                ++n_inserted;
+            } else {
+                std::size_t k = gen() % live.size();
+                dynamic.erase(live[k]);
+                live[k] = live.back();
+                live.pop_back();
+                ++n_erased;
+            }
+        }
+    });
+
+    std::vector<Point_2> expected;
+    double recompute_t = time_seconds([&] {
+        CGAL::convex_hull_2(live.begin(), live.end(),
+                            std::back_inserter(expected));
+    });
+
+    hull.clear();
+    dynamic.hull(std::back_inserter(hull));
+
+    std::cout << distribution_name(distribution) << " (" << n_live
+              << " live points, " << n_inserted << " insertions, "
+              << n_erased << " deletions, " << expected.size()
+              << " hull points)" << std::endl;
+    std::cout << "  building DynamicHull:    " << build_t << " s" << std::endl;
+    std::cout << "  DynamicHull update:      "
+              << update_t / n_updates * 1e6 << " us" << std::endl;
+    std::cout << "  convex_hull_2 recompute: " << recompute_t * 1e6 << " us, "
+              << recompute_t / (update_t / n_updates) << "x slower"
+              << std::endl;
+    std::cout << "  hulls " << (hull == expected ? "identical" : "DIFFER")
+              << std::endl;
+}
+
+void
+bench_window(std::size_t n_live, std::size_t n_updates) {
+    auto points = random_points<Point_2>(Distribution::uniform_disk,
+                                         n_live + n_updates);
+    std::sort(points.begin(), points.end());
+    // The live points are those in [oldest, next).
+    auto oldest = points.begin(), next = points.begin() + n_live;
+
+    DynamicHull<Kernel> dynamic(oldest, next);
+    double update_t = time_seconds([&] {
+        for (std::size_t i = 0; i < n_updates; ++i) {
+            if (i % 2 == 0) {
+                dynamic.insert(*next++);
+            } else {
+                dynamic.erase(*oldest++);
+            }
+        }
+    });
+
+    std::vector<Point_2> expected;
+    double recompute_t = time_seconds([&] {
+        CGAL::convex_hull_2(oldest, next, std::back_inserter(expected));
+    });
+    std::vector<Point_2> hull;
+    dynamic.hull(std::back_inserter(hull));
+
+    std::cout << "sliding window (" << n_live << " live points, "
+              << n_updates << " updates, " << expected.size()
+              << " hull points)" << std::endl;
+    std::cout << "  DynamicHull update:      "
+              << update_t / n_updates * 1e6 << " us" << std::endl;
+    std::cout << "  convex_hull_2 recompute: " << recompute_t * 1e6 << " us, "
+              << recompute_t / (update_t / n_updates) << "x slower"
+              << std::endl;
+    std::cout << "  hulls " << (hull == expected ? "identical" : "DIFFER")
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n_live = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+    auto n_updates = static_cast<std::size_t>(arg_or(argc, argv, 2, 1'000'000));
+
+    bench(Distribution::uniform_disk, n_live, n_updates);
+    bench(Distribution::gaussian, n_live, n_updates);
+    bench_window(n_live, n_updates);
+
+    return 0;
+
+}
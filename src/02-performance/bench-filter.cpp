@@ -0,0 +1,70 @@
+// Compares FracTraits (always exact) with FilteredFracTraits (double filter,
+// exact fallback) inside CGAL::ch_graham_andrew(), and reports how often the
+// filter had to fall back to exact arithmetic.
+//
+// usage: bench-filter [n_points]
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "filtered_frac_traits.h"
+
+void
+bench(const std::string &name, const std::vector<FracPoint2> &points) {
+    std::vector<FracPoint2> exact_hull;
+    double exact_t = time_seconds([&] {
+        CGAL::ch_graham_andrew(points.begin(), points.end(),
+                               std::back_inserter(exact_hull), FracTraits());
+    });
+
+    FilteredFracTraits<> traits;
+    std::vector<FracPoint2> hull;
+    double t = time_seconds([&] {
+        CGAL::ch_graham_andrew(points.begin(), points.end(),
+                               std::back_inserter(hull), traits);
+    });
+
+    bool same = hull.size() == exact_hull.size();
+    auto equal = FracTraits().equal_2_object();
+    for (std::size_t i = 0; same && i < hull.size(); ++i) {
+        same = equal(hull[i], exact_hull[i]);
+    }
+
+    const Filter_statistics &s = traits.statistics();
+    std::cout << name << " (" << points.size() << " points)" << std::endl;
+    std::cout << "  exact:    " << exact_t << " s" << std::endl;
+    std::cout << "  filtered: " << t << " s, " << exact_t / t
+              << "x, hulls " << (same ? "identical" : "DIFFER") << std::endl;
+    std::cout << "  filter failures: Less_xy_2 " << s.less_xy_failures << "/"
+              << s.less_xy_calls << ", Left_turn_2 " << s.left_turn_failures
+              << "/" << s.left_turn_calls << ", Equal_2 " << s.equal_failures
+              << "/" << s.equal_calls << ", overall "
+              << 100.0 * s.failure_rate() << "%" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+
+    // Generic position: the filter should almost never fail.
+    bench("small components",
+          random_frac_points<FracPoint2>(n, 10'000, 8));
+
+    // Large components: the exact predicates take the WideInt path, which is
+    // where the filter pays off most.
+    bench("large components",
+          random_frac_points<FracPoint2>(n, 4'000'000'000'000LL,
+                                         1'000'000'000));
+
+    // A small integer grid: lots of equal x's and collinear triples, so the
+    // filter fails often and we see its overhead.
+    bench("integer grid", random_frac_points<FracPoint2>(n, 100, 1));
+
+    return 0;
+
+}
@@ -0,0 +1,96 @@
+// Times convex_hull_2_fixed() (see fixed_hull.h) against the generic
+// CGAL::convex_hull_2() and CGAL::ch_graham_andrew() on arrays of N random
+// points, for N = 3, ..., 16. As in part-iv.cpp, the input is a
+// std::array<Point_2, N> and the hull goes to an array of N points, so the
+// generic routines do not pay for a growing output vector.
+//
+// usage: bench-fixed-hull [n_hulls]
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "fixed_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+template <std::size_t N>
+void
+bench(std::size_t n_hulls) {
+    auto points = random_points<Point_2>(Distribution::uniform_disk,
+                                         n_hulls * N);
+    std::vector<std::array<Point_2, N>> sets(n_hulls);
+    for (std::size_t i = 0; i < n_hulls; ++i) {
+        std::copy(points.begin() + i * N, points.begin() + (i + 1) * N,
+                  sets[i].begin());
+    }
+
+    // Sums of the hull sizes, which keep the work from being optimized
+    // away, and tell whether the hulls agree.
+    std::size_t n_generic = 0, n_graham_andrew = 0, n_fixed = 0;
+    std::array<Point_2, N> result;
+    auto time = [&](std::size_t &n_hull_points, auto hull) {
+        return best_seconds(3, [&] {
+            n_hull_points = 0;
+            for (const auto &set : sets) {
+                n_hull_points += hull(set) - result.begin();
+            }
+        });
+    };
+    double generic_t = time(n_generic, [&](const auto &set) {
+        return CGAL::convex_hull_2(set.begin(), set.end(), result.begin());
+    });
+    double graham_andrew_t = time(n_graham_andrew, [&](const auto &set) {
+        return CGAL::ch_graham_andrew(set.begin(), set.end(),
+                                      result.begin());
+    });
+    double fixed_t = time(n_fixed, [&](const auto &set) {
+        return convex_hull_2_fixed(set, result.begin());
+    });
+
+    bool same = true;
+    std::vector<Point_2> expected, hull;
+    for (const auto &set : sets) {
+        expected.clear();
+        hull.clear();
+        CGAL::ch_graham_andrew(set.begin(), set.end(),
+                               std::back_inserter(expected));
+        convex_hull_2_fixed(set, std::back_inserter(hull));
+        same = same && hull == expected;
+    }
+
+    std::cout << N << "\t" << generic_t / n_hulls * 1e9 << "\t"
+              << graham_andrew_t / n_hulls * 1e9 << "\t"
+              << fixed_t / n_hulls * 1e9 << "\t"
+              << graham_andrew_t / fixed_t << "x\t"
+              << (same && n_fixed == n_graham_andrew ? "identical" : "DIFFER")
+              << std::endl;
+}
+
+template <std::size_t... I>
+void
+bench_all(std::size_t n_hulls, std::index_sequence<I...>) {
+    (bench<I + 3>(n_hulls), ...);
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n_hulls = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+
+    std::cout << n_hulls << " hulls, ns per hull" << std::endl;
+    std::cout << "N\tconvex_hull_2\tch_graham_andrew\tfixed\tspeedup\thulls"
+              << std::endl;
+    bench_all(n_hulls, std::make_index_sequence<14>());
+
+    return 0;
+
+}
@@ -0,0 +1,117 @@
+// Compares the overflow-safe Frac (frac.h) with the toy Frac from part-vii.cpp.
+//
+// usage: bench-frac [n_points]
+//
+// We first run CGAL::ch_graham_andrew() on n random fractional points whose
+// components are small enough for the toy class to get every predicate right,
+// so that the two throughputs can be compared fairly (and we check that both
+// produce the same hull). Then we look at what happens once the components
+// are large: the toy class starts giving wrong answers, while the new class
+// either gets them right or throws std::overflow_error.
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "frac_traits.h"
+#include "toy_frac.h"
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    // Part 1: throughput on inputs that both classes handle correctly.
+    {
+        const long long max_num = 10'000, max_den = 8;
+        auto toy_points =
+            random_frac_points<toy::FracPoint2>(n, max_num, max_den);
+        auto points = random_frac_points<FracPoint2>(n, max_num, max_den);
+
+        std::vector<toy::FracPoint2> toy_hull;
+        double toy_t = time_seconds([&] {
+            CGAL::ch_graham_andrew(toy_points.begin(), toy_points.end(),
+                                   std::back_inserter(toy_hull),
+                                   toy::Traits());
+        });
+
+        std::vector<FracPoint2> hull;
+        double t = time_seconds([&] {
+            CGAL::ch_graham_andrew(points.begin(), points.end(),
+                                   std::back_inserter(hull), FracTraits());
+        });
+
+        // The hull is a subset of the input, so the two results must have
+        // the same values. (Only the same values: Frac reduces the input
+        // fractions, the toy version keeps them as given.)
+        auto same_value = [](const auto &toy, const Frac &f) {
+            return static_cast<i128>(toy.num()) * f.den() ==
+                   static_cast<i128>(f.num()) * toy.den();
+        };
+        bool same = toy_hull.size() == hull.size();
+        for (std::size_t i = 0; same && i < hull.size(); ++i) {
+            same = same_value(toy_hull[i].x(), hull[i].x()) &&
+                   same_value(toy_hull[i].y(), hull[i].y());
+        }
+
+        std::cout << "ch_graham_andrew on " << n << " points" << std::endl;
+        std::cout << "  toy Frac:  " << toy_t << " s, "
+                  << n / toy_t / 1e6 << " Mpts/s, "
+                  << toy_hull.size() << " hull points" << std::endl;
+        std::cout << "  Frac:      " << t << " s, "
+                  << n / t / 1e6 << " Mpts/s, "
+                  << hull.size() << " hull points" << std::endl;
+        std::cout << "  speed-up:  " << toy_t / t << "x, hulls "
+                  << (same ? "identical" : "DIFFER") << std::endl;
+    }
+
+    // Part 2: comparisons with components around 4e9, where the toy class'
+    // cross-multiplications overflow.
+    {
+        const std::size_t n_pairs = 1'000'000;
+        std::mt19937_64 gen(7);
+        std::uniform_int_distribution<long long> comp(1, 4'000'000'000LL);
+
+        std::size_t wrong = 0;
+        for (std::size_t i = 0; i < n_pairs; ++i) {
+            long long a = comp(gen), b = comp(gen);
+            long long c = comp(gen), d = comp(gen);
+            bool toy_less = toy::Frac(a, b) < toy::Frac(c, d);
+            bool less = Frac(a, b) < Frac(c, d);
+            wrong += toy_less != less;
+        }
+
+        std::cout << "comparisons of fractions with components up to 4e9"
+                  << std::endl;
+        std::cout << "  toy Frac got " << wrong << " of " << n_pairs
+                  << " wrong" << std::endl;
+    }
+
+    // Part 3: a hull on large components. The toy class returns whatever its
+    // overflowed arithmetic produces; the new class either succeeds or tells us
+    // that the exact result cannot be represented.
+    {
+        const long long max_num = 4'000'000'000LL, max_den = 1'000'000;
+        auto points = random_frac_points<FracPoint2>(
+            std::min<std::size_t>(n, 100'000), max_num, max_den);
+
+        std::vector<FracPoint2> hull;
+        try {
+            CGAL::ch_graham_andrew(points.begin(), points.end(),
+                                   std::back_inserter(hull), FracTraits());
+            std::cout << "large components: Frac hull has " << hull.size()
+                      << " points" << std::endl;
+        } catch (const std::overflow_error &e) {
+            std::cout << "large components: Frac detected overflow ("
+                      << e.what() << ")" << std::endl;
+        }
+    }
+
+    return 0;
+
+}
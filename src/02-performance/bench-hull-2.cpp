@@ -0,0 +1,220 @@
+// Runs the 2D hull algorithms of CGAL, as chosen from by convex_hull_2() (see
+// part-vi.cpp), over a sweep of kernels, point distributions and sizes, and
+// writes the times as JSON to stdout, for picking an algorithm per workload
+// and for catching regressions. Progress goes to stderr.
+//
+// usage: bench-hull-2 [max_n] [min_seconds]
+//
+// The sweep:
+//    * kernels: Epick, Epeck, Simple_cartesian<double>, and the Traits of
+//      part-vii.cpp (toy_frac.h) with the points scaled by 1000 and rounded
+//      to eighths,
+//    * distributions: those of point_generators.h,
+//    * sizes: 10, 100, ..., max_n (1e8 by default), and at most 1e7 for
+//      Epeck and the toy Traits, whose points are too large to hold more,
+//    * algorithms: ch_graham_andrew, ch_akl_toussaint, ch_bykat, ch_eddy,
+//      ch_jarvis and ch_melkman. The toy Traits only provides what
+//      ch_graham_andrew needs, so only that runs with it. ch_jarvis is
+//      O(n h) and is skipped where n h > 1e9. ch_melkman needs a simple
+//      polyline, so it gets the points sorted by angle around their
+//      centroid, which makes a star-shaped one; the sorting is not timed.
+//
+// Each configuration runs 1, 2, 4, ... times until min_seconds (0.1 by
+// default) have passed, and is reported as one record:
+//
+//    {"kernel": "Epick", "algorithm": "ch_bykat",
+//     "distribution": "uniform disk", "n": 1000, "runs": 512,
+//     "seconds": 2.1e-05, "ns_per_point": 21, "hull_size": 31,
+//     "agrees": true}
+//
+// where seconds is the time per run and agrees tells whether the hull is
+// that of ch_graham_andrew for the same kernel and points, vertex by vertex
+// and in the same order, once both are rotated to start from their smallest
+// point (ch_melkman starts elsewhere). Simple_cartesian<double> has inexact
+// predicates, so it may not agree.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/convex_hull_2.h>
+#include <CGAL/number_utils.h>
+
+#include "bench_util.h"
+#include "hull_algorithms.h"
+#include "point_generators.h"
+#include "toy_frac.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Epick;
+typedef CGAL::Exact_predicates_exact_constructions_kernel Epeck;
+typedef CGAL::Simple_cartesian<double> Cartesian;
+
+// The largest n for Epeck and the toy Traits.
+constexpr std::size_t max_n_large_points = 10'000'000;
+
+// ch_jarvis is skipped where n times the hull size is larger than this.
+constexpr double max_jarvis_work = 1e9;
+
+// Runs f 1, 2, 4, ... times until at least min_seconds have passed, and
+// returns the time per run. runs receives the number of runs of the last
+// round.
+template <typename F>
+double
+seconds_per_run(double min_seconds, F &&f, std::size_t &runs) {
+    for (runs = 1;; runs *= 2) {
+        double t = time_seconds([&] {
+            for (std::size_t i = 0; i < runs; ++i) {
+                f();
+            }
+        });
+        if (t >= min_seconds) {
+            return t / static_cast<double>(runs);
+        }
+    }
+}
+
+// Writes one record of the "results" array.
+class Json_results {
+public:
+
+    void
+    write(const std::string &kernel, const std::string &algorithm,
+          Distribution distribution, std::size_t n, std::size_t runs,
+          double seconds, std::size_t hull_size, bool agrees) {
+        std::cout << (_first ? "\n" : ",\n") << "    {\"kernel\": \"" << kernel
+                  << "\", \"algorithm\": \"" << algorithm
+                  << "\", \"distribution\": \""
+                  << distribution_name(distribution) << "\", \"n\": " << n
+                  << ", \"runs\": " << runs << ", \"seconds\": " << seconds
+                  << ", \"ns_per_point\": "
+                  << seconds / static_cast<double>(n) * 1e9
+                  << ", \"hull_size\": " << hull_size << ", \"agrees\": "
+                  << (agrees ? "true" : "false") << "}";
+        _first = false;
+    }
+
+private:
+    bool _first = true;
+};
+
+// Sorts points by angle around their centroid, into a star-shaped polygon.
+template <typename Point>
+void
+sort_by_angle(std::vector<Point> &points) {
+    double cx = 0.0, cy = 0.0;
+    for (const Point &p : points) {
+        cx += CGAL::to_double(p.x());
+        cy += CGAL::to_double(p.y());
+    }
+    cx /= static_cast<double>(points.size());
+    cy /= static_cast<double>(points.size());
+    std::vector<std::pair<double, std::size_t>> angles(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        angles[i] = {std::atan2(CGAL::to_double(points[i].y()) - cy,
+                                CGAL::to_double(points[i].x()) - cx), i};
+    }
+    std::sort(angles.begin(), angles.end());
+    std::vector<Point> sorted;
+    sorted.reserve(points.size());
+    for (const auto &angle : angles) {
+        sorted.push_back(points[angle.second]);
+    }
+    points = std::move(sorted);
+}
+
+// Rotates a hull to start from its smallest point, to compare hulls by.
+template <typename Point, typename Traits>
+void
+rotate_to_smallest(std::vector<Point> &hull, const Traits &traits) {
+    std::rotate(hull.begin(),
+                std::min_element(hull.begin(), hull.end(),
+                                 traits.less_xy_2_object()),
+                hull.end());
+}
+
+// The sweep for one kernel or traits class. FullTraits tells whether it is a
+// full hull traits class, for the algorithms other than ch_graham_andrew.
+template <bool FullTraits, typename Traits, typename MakePoint>
+void
+sweep(const std::string &kernel, const Traits &traits, MakePoint make_point,
+      std::size_t max_n, double min_seconds, Json_results &results) {
+    using Point = typename Traits::Point_2;
+
+    for (Distribution distribution : all_distributions) {
+        for (std::size_t n = 10; n <= max_n; n *= 10) {
+            std::cerr << kernel << ", " << distribution_name(distribution)
+                      << ", " << n << " points" << std::endl;
+            auto points = random_points<Point>(distribution, n, make_point);
+            std::vector<Point> hull, expected;
+            auto run = [&](const std::string &name, auto algorithm) {
+                std::size_t runs = 0;
+                double seconds = seconds_per_run(min_seconds, [&] {
+                    hull.clear();
+                    algorithm(points.begin(), points.end(),
+                              std::back_inserter(hull), traits);
+                }, runs);
+                rotate_to_smallest(hull, traits);
+                if (name == "ch_graham_andrew") {
+                    expected = hull;
+                }
+                const bool agrees = std::equal(hull.begin(), hull.end(),
+                                               expected.begin(), expected.end(),
+                                               traits.equal_2_object());
+                results.write(kernel, name, distribution, n, runs, seconds,
+                              hull.size(), agrees);
+            };
+
+            run("ch_graham_andrew", Graham_andrew());
+            if constexpr (FullTraits) {
+                run("ch_akl_toussaint", Akl_toussaint());
+                run("ch_bykat", Bykat());
+                run("ch_eddy", Eddy());
+                if (static_cast<double>(n) *
+                    static_cast<double>(expected.size())
+                    <= max_jarvis_work) {
+                    run("ch_jarvis", Jarvis());
+                }
+                sort_by_angle(points);
+                run("ch_melkman", Melkman());
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    auto max_n = static_cast<std::size_t>(arg_or(argc, argv, 1, 100'000'000));
+    const double min_seconds = argc > 2 ? std::atof(argv[2]) : 0.1;
+    const std::size_t max_n_large = std::min(max_n, max_n_large_points);
+
+    std::cout << "{\n  \"benchmark\": \"bench-hull-2\",\n"
+              << "  \"min_seconds\": " << min_seconds << ",\n"
+              << "  \"results\": [";
+    Json_results results;
+    sweep<true>("Epick", Epick(),
+                [](double x, double y) { return Epick::Point_2(x, y); },
+                max_n, min_seconds, results);
+    sweep<true>("Epeck", Epeck(),
+                [](double x, double y) { return Epeck::Point_2(x, y); },
+                max_n_large, min_seconds, results);
+    sweep<true>("Simple_cartesian<double>", Cartesian(),
+                [](double x, double y) { return Cartesian::Point_2(x, y); },
+                max_n, min_seconds, results);
+    // As in bench-chan.cpp, scaled so that the toy Frac does not overflow.
+    sweep<false>("part-vii Traits", toy::Traits(), [](double x, double y) {
+        return toy::FracPoint2(toy::Frac(std::llround(x * 8000), 8),
+                               toy::Frac(std::llround(y * 8000), 8));
+    }, max_n_large, min_seconds, results);
+    std::cout << "\n  ]\n}" << std::endl;
+
+    return 0;
+
+}
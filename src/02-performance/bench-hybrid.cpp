@@ -0,0 +1,160 @@
+// Compares HybridFrac (inline long long words, GMP on overflow) with
+// CGAL::Gmpq, and reports how often HybridFrac stays on the inline fast path.
+//
+// usage: bench-hybrid [n_values]
+//
+// Two workloads:
+//    1) orientation determinants of random points with small fractional
+//       coordinates - short expressions whose results always fit inline;
+//    2) chains of constructions p = (p + r) / 2 + s, whose denominators keep
+//       growing until they no longer fit and the values are promoted to GMP.
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <CGAL/Gmpq.h>
+
+#include "bench_util.h"
+#include "hybrid_frac.h"
+
+struct Ratio {
+    long long num, den;
+};
+
+// Operation counts; inline_results is only filled in for HybridFrac.
+struct Counts {
+    std::size_t ops = 0;
+    std::size_t inline_results = 0;
+};
+
+std::vector<Ratio>
+random_ratios(std::size_t n, long long max_num, long long max_den) {
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long long> num(-max_num, max_num);
+    std::uniform_int_distribution<long long> den(1, max_den);
+    std::vector<Ratio> r(n);
+    for (auto &x : r) {
+        x = {num(gen), den(gen)};
+    }
+    return r;
+}
+
+template <typename NT>
+NT
+make(const Ratio &r);
+
+template <>
+HybridFrac
+make<HybridFrac>(const Ratio &r) {
+    return {r.num, r.den};
+}
+
+template <>
+CGAL::Gmpq
+make<CGAL::Gmpq>(const Ratio &r) {
+    return {static_cast<long>(r.num), static_cast<long>(r.den)};
+}
+
+double
+approximate(const HybridFrac &f) {
+    return f.to_double();
+}
+
+double
+approximate(const CGAL::Gmpq &q) {
+    return CGAL::to_double(q);
+}
+
+template <typename NT>
+void
+count(const NT &result, std::size_t ops, Counts &counts) {
+    counts.ops += ops;
+    if constexpr (std::is_same_v<NT, HybridFrac>) {
+        counts.inline_results += ops * result.is_inline();
+    }
+}
+
+// Orientation determinants over consecutive sextuples of values; returns the
+// number of positive ones.
+template <typename NT>
+double
+determinants(const std::vector<Ratio> &v, Counts &counts) {
+    std::size_t n_positive = 0;
+    for (std::size_t i = 0; i + 6 <= v.size(); i += 6) {
+        NT x0 = make<NT>(v[i]), y0 = make<NT>(v[i + 1]);
+        NT x1 = make<NT>(v[i + 2]), y1 = make<NT>(v[i + 3]);
+        NT x2 = make<NT>(v[i + 4]), y2 = make<NT>(v[i + 5]);
+        NT det = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+        n_positive += det > NT(0);
+        count(det, 7, counts);
+    }
+    return static_cast<double>(n_positive);
+}
+
+// Chains of 'length' constructions; returns the sum of the final values as a
+// checksum.
+template <typename NT>
+double
+chains(const std::vector<Ratio> &v, std::size_t length, Counts &counts) {
+    double checksum = 0;
+    const NT two(2);
+    std::size_t i = 0;
+    while (i + 2 * length <= v.size()) {
+        NT p(0);
+        for (std::size_t k = 0; k < length; ++k, i += 2) {
+            p = (p + make<NT>(v[i])) / two + make<NT>(v[i + 1]);
+            count(p, 3, counts);
+        }
+        checksum += approximate(p);
+    }
+    return checksum;
+}
+
+template <typename Workload>
+void
+bench(const std::string &name, Workload workload) {
+    Counts hybrid, gmpq;
+    double hybrid_result = 0, gmpq_result = 0;
+    double hybrid_t = time_seconds([&] {
+        hybrid_result = workload(HybridFrac(), hybrid);
+    });
+    double gmpq_t = time_seconds([&] {
+        gmpq_result = workload(CGAL::Gmpq(), gmpq);
+    });
+    bool agree = std::abs(hybrid_result - gmpq_result) <=
+                 1e-9 * std::abs(gmpq_result);
+
+    std::cout << name << std::endl;
+    std::cout << "  HybridFrac: " << hybrid_t << " s, "
+              << hybrid.ops / hybrid_t / 1e6 << " M ops/s, inline hit rate "
+              << 100.0 * hybrid.inline_results / hybrid.ops << "%"
+              << std::endl;
+    std::cout << "  Gmpq:       " << gmpq_t << " s, "
+              << gmpq.ops / gmpq_t / 1e6 << " M ops/s" << std::endl;
+    std::cout << "  speed-up:   " << gmpq_t / hybrid_t << "x, results "
+              << (agree ? "agree" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 6'000'000));
+    auto values = random_ratios(n, 1000, 100);
+
+    bench("orientation determinants", [&](auto nt, Counts &counts) {
+        return determinants<decltype(nt)>(values, counts);
+    });
+
+    for (std::size_t length : {10, 40, 200}) {
+        bench("construction chains of length " + std::to_string(length),
+              [&](auto nt, Counts &counts) {
+                  return chains<decltype(nt)>(values, length, counts);
+              });
+    }
+
+    return 0;
+
+}
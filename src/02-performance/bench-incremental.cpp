@@ -0,0 +1,99 @@
+// Feeds a stream of points, in batches of 1000, to IncrementalHull (see
+// incremental_hull.h), and compares it with keeping the hull up to date with
+// CGAL::convex_hull_2(), which has to recompute it for every batch. To give
+// the recomputation a fair chance it only gets the previous hull and the new
+// batch, rather than every point so far; we also report what recomputing
+// from all the points would cost for one batch at the end of the stream.
+//
+// usage: bench-incremental [n_points]
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "incremental_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+const std::size_t batch_size = 1000;
+
+void
+bench(Distribution distribution, std::size_t n) {
+    auto points = random_points<Point_2>(distribution, n);
+    const std::size_t n_batches = (n + batch_size - 1) / batch_size;
+    auto batch_end = [&](std::size_t b) {
+        return points.begin() + std::min(n, (b + 1) * batch_size);
+    };
+
+    // The first batch seeds both.
+    std::vector<Point_2> seed;
+    CGAL::convex_hull_2(points.begin(), batch_end(0),
+                        std::back_inserter(seed));
+
+    IncrementalHull<Kernel> incremental(seed.begin(), seed.end());
+    double incremental_t = time_seconds([&] {
+        for (std::size_t b = 1; b < n_batches; ++b) {
+            for (auto it = batch_end(b - 1); it != batch_end(b); ++it) {
+                incremental.insert(*it);
+            }
+        }
+    });
+
+    std::vector<Point_2> hull = seed;
+    double recompute_t = time_seconds([&] {
+        std::vector<Point_2> input, next;
+        for (std::size_t b = 1; b < n_batches; ++b) {
+            input.assign(hull.begin(), hull.end());
+            input.insert(input.end(), batch_end(b - 1), batch_end(b));
+            next.clear();
+            CGAL::convex_hull_2(input.begin(), input.end(),
+                                std::back_inserter(next));
+            hull.swap(next);
+        }
+    });
+
+    std::vector<Point_2> expected;
+    double scratch_t = time_seconds([&] {
+        CGAL::convex_hull_2(points.begin(), points.end(),
+                            std::back_inserter(expected));
+    });
+
+    std::vector<Point_2> incremental_hull(incremental.vertices().begin(),
+                                          incremental.vertices().end());
+    bool same = incremental_hull == expected && hull == expected;
+
+    std::cout << distribution_name(distribution) << " (" << n << " points, "
+              << n_batches << " batches, " << expected.size()
+              << " hull points)" << std::endl;
+    std::cout << "  IncrementalHull:           " << incremental_t << " s, "
+              << incremental_t / n_batches * 1e6 << " us per batch"
+              << std::endl;
+    std::cout << "  convex_hull_2(hull+batch): " << recompute_t << " s, "
+              << recompute_t / n_batches * 1e6 << " us per batch, "
+              << recompute_t / incremental_t << "x slower" << std::endl;
+    std::cout << "  convex_hull_2(all points): " << scratch_t * 1e6
+              << " us for the last batch" << std::endl;
+    std::cout << "  hulls " << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    bench(Distribution::uniform_disk, n);
+    bench(Distribution::uniform_square, n);
+    bench(Distribution::gaussian, n);
+    // Here almost every point is on the hull, so the recomputation handles
+    // the whole stream so far for every batch; we use fewer points.
+    bench(Distribution::on_circle, n / 100);
+
+    return 0;
+
+}
@@ -0,0 +1,109 @@
+// Computes the hull of points on an integer grid, loaded into the Point_2 of
+// the EPICK kernel as in part-iv.cpp, with CGAL::convex_hull_2(),
+// CGAL::ch_graham_andrew() and int_convex_hull_2() (see int_hull.h), and of
+// the same points loaded as IntPoint2 with CGAL::ch_graham_andrew() and
+// IntTraits. The grids are the distributions of point_generators.h scaled to
+// [-scale, scale] and rounded. Last, int_convex_hull_2() is run on the points
+// before rounding, to see what the failed check costs.
+//
+// usage: bench-int-hull [n_points] [scale]
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "int_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 100'000'000));
+    const double scale = static_cast<double>(arg_or(argc, argv, 2, 1'000'000));
+
+    for (Distribution distribution : all_distributions) {
+        auto points = random_points<Point_2>(distribution, n,
+                                             [&](double x, double y) {
+            return Point_2(std::round(x * scale), std::round(y * scale));
+        });
+        std::vector<IntPoint2> int_points;
+        int_points.reserve(n);
+        for (const Point_2 &p : points) {
+            int_points.emplace_back(static_cast<std::int32_t>(p.x()),
+                                    static_cast<std::int32_t>(p.y()));
+        }
+        std::cout << distribution_name(distribution) << ", " << n
+                  << " points on the grid [-" << scale << ", " << scale
+                  << "]^2" << std::endl;
+
+        std::vector<Point_2> expected;
+        double graham_andrew_t = best_seconds(3, [&] {
+            expected.clear();
+            CGAL::ch_graham_andrew(points.begin(), points.end(),
+                                   std::back_inserter(expected));
+        });
+
+        std::vector<Point_2> hull;
+        double convex_hull_t = best_seconds(3, [&] {
+            hull.clear();
+            CGAL::convex_hull_2(points.begin(), points.end(),
+                                std::back_inserter(hull));
+        });
+        std::cout << "  convex_hull_2:                 " << convex_hull_t
+                  << " s" << std::endl;
+        std::cout << "  ch_graham_andrew:              " << graham_andrew_t
+                  << " s, " << expected.size() << " hull points" << std::endl;
+
+        double detect_t = best_seconds(3, [&] {
+            hull.clear();
+            int_convex_hull_2(points.begin(), points.end(),
+                              std::back_inserter(hull));
+        });
+        std::cout << "  int_convex_hull_2:             " << detect_t
+                  << " s, " << graham_andrew_t / detect_t << "x, hull "
+                  << (hull == expected ? "identical" : "DIFFERS")
+                  << std::endl;
+
+        std::vector<IntPoint2> int_hull;
+        double int_t = best_seconds(3, [&] {
+            int_hull.clear();
+            CGAL::ch_graham_andrew(int_points.begin(), int_points.end(),
+                                   std::back_inserter(int_hull), IntTraits());
+        });
+        bool same = int_hull.size() == expected.size();
+        for (std::size_t i = 0; same && i < int_hull.size(); ++i) {
+            same = int_hull[i].x() == expected[i].x() &&
+                   int_hull[i].y() == expected[i].y();
+        }
+        std::cout << "  IntPoint2, IntTraits:          " << int_t
+                  << " s, " << graham_andrew_t / int_t << "x, hull "
+                  << (same ? "identical" : "DIFFERS") << std::endl;
+
+        // The same distribution off the grid, where the check fails.
+        points = random_points<Point_2>(distribution, n);
+        double plain_t = best_seconds(3, [&] {
+            expected.clear();
+            CGAL::ch_graham_andrew(points.begin(), points.end(),
+                                   std::back_inserter(expected));
+        });
+        double fallback_t = best_seconds(3, [&] {
+            hull.clear();
+            int_convex_hull_2(points.begin(), points.end(),
+                              std::back_inserter(hull));
+        });
+        std::cout << "  off the grid, int_convex_hull_2: " << fallback_t
+                  << " s, " << plain_t / fallback_t << "x, hull "
+                  << (hull == expected ? "identical" : "DIFFERS")
+                  << std::endl;
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,123 @@
+// Compares Filtered_kernel<Simple_cartesian<Frac>> (frac_cgal.h) with
+// Exact_predicates_exact_constructions_kernel on the collinearity tests of
+// part-iii.cpp, scaled up to millions of triples.
+//
+// usage: bench-kernel [n_triples]
+//
+// The triples cycle through the three kinds of blocks in part-iii.cpp:
+//    1) y increasing in steps of 0.3, built from doubles,
+//    2) y increasing in steps of 1/3, built exactly, and
+//    3) y increasing in steps of 1.
+// Both kernels are exact, so they must agree on every answer.
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "frac_cgal.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Epeck;
+
+// Builds n triples of points in kernel K. make_ft(num, den) must produce the
+// exact value num / den as a K::FT.
+template <typename K, typename MakeFT>
+std::vector<typename K::Point_2>
+make_triples(std::size_t n, MakeFT make_ft) {
+    typedef typename K::Point_2 Point_2;
+    std::vector<Point_2> points;
+    points.reserve(3 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto k = static_cast<long long>(i / 3 % 1000);
+        for (long long j = 0; j < 3; ++j) {
+            switch (i % 3) {
+                case 0:
+                    points.emplace_back(typename K::FT(double(k + j)),
+                                        typename K::FT(0.3 * double(k + j + 1)));
+                    break;
+                case 1:
+                    points.emplace_back(make_ft(k + j, 1),
+                                        make_ft(k + j + 1, 3));
+                    break;
+                default:
+                    points.emplace_back(make_ft(k + j, 1), make_ft(k + j, 1));
+                    break;
+            }
+        }
+    }
+    return points;
+}
+
+template <typename K>
+std::vector<bool>
+bench(const std::string &name,
+      const std::vector<typename K::Point_2> &points) {
+    std::vector<bool> collinear(points.size() / 3);
+    double t = time_seconds([&] {
+        for (std::size_t i = 0; i < collinear.size(); ++i) {
+            collinear[i] = CGAL::collinear(points[3 * i], points[3 * i + 1],
+                                           points[3 * i + 2]);
+        }
+    });
+    std::size_t n_collinear = 0;
+    for (bool c : collinear) {
+        n_collinear += c;
+    }
+    std::cout << "  " << name << ": " << t << " s, "
+              << collinear.size() / t / 1e6 << " M triples/s, "
+              << n_collinear << " collinear" << std::endl;
+    return collinear;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 3'000'000));
+
+    std::vector<FilteredFracKernel::Point_2> frac_points;
+    double frac_build_t = time_seconds([&] {
+        frac_points = make_triples<FilteredFracKernel>(
+            n, [](long long num, long long den) { return Frac(num, den); });
+    });
+
+    std::vector<Epeck::Point_2> epeck_points;
+    double epeck_build_t = time_seconds([&] {
+        epeck_points = make_triples<Epeck>(
+            n, [](long long num, long long den) {
+                return Epeck::FT(double(num)) / Epeck::FT(double(den));
+            });
+    });
+
+    std::cout << "building " << n << " triples" << std::endl;
+    std::cout << "  Filtered_kernel<Simple_cartesian<Frac>>: " << frac_build_t
+              << " s" << std::endl;
+    std::cout << "  Epeck:                                   " << epeck_build_t
+              << " s" << std::endl;
+
+    std::cout << "collinear() on " << n << " triples" << std::endl;
+    auto frac_result = bench<FilteredFracKernel>(
+        "Filtered_kernel<Simple_cartesian<Frac>>", frac_points);
+    auto exact_result = bench<FracKernel>(
+        "Simple_cartesian<Frac>                 ",
+        make_triples<FracKernel>(
+            n, [](long long num, long long den) { return Frac(num, den); }));
+    auto epeck_result = bench<Epeck>(
+        "Epeck                                  ", epeck_points);
+    std::cout << "  results "
+              << (frac_result == epeck_result && exact_result == epeck_result
+                  ? "agree" : "DISAGREE") << std::endl;
+
+    // And since FilteredFracKernel is a full kernel, the algorithms from the
+    // first chapter work with it unchanged.
+    std::vector<FilteredFracKernel::Point_2> hull;
+    CGAL::convex_hull_2(frac_points.begin(), frac_points.end(),
+                        std::back_inserter(hull));
+    std::cout << "convex_hull_2 over all the points: " << hull.size()
+              << " hull points" << std::endl;
+
+    return 0;
+
+}
@@ -0,0 +1,131 @@
+// Compares four Left_turn_2 predicates for fractional points:
+//    * the toy Traits from part-vii.cpp,
+//    * the cross(p1 - p0, p2 - p0) formulation on the overflow-safe Frac,
+//      with the differences and the cross product built as values,
+//    * the same expression written with the point expression templates of
+//      frac_point_2.h, which turn it into a call of orientation(), and
+//    * FracTraits::Left_turn_2, which calls orientation() and never builds an
+//      intermediate Frac.
+//
+// usage: bench-orientation [n_points]
+//
+// We time the predicates on their own (over consecutive triples of random
+// points) and inside CGAL::ch_graham_andrew().
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "frac_traits.h"
+#include "toy_frac.h"
+
+// FracTraits with the Left_turn_2 it had before orientation() was introduced:
+// every intermediate result is a FracPoint2 or a Frac.
+class CrossFracTraits : public FracTraits {
+public:
+    class Left_turn_2 {
+    public:
+        bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            FracPoint2 d1 = p1 - p0, d2 = p2 - p0;
+            Frac c = cross(d1, d2);
+            return c.positive();
+        }
+    };
+
+    [[nodiscard]] Left_turn_2
+    left_turn_2_object() const {
+        return {};
+    }
+};
+
+// The same predicate as a single expression, which the expression templates
+// evaluate without building any intermediate value.
+class ExpressionFracTraits : public FracTraits {
+public:
+    class Left_turn_2 {
+    public:
+        bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            return cross(p1 - p0, p2 - p0).positive();
+        }
+    };
+
+    [[nodiscard]] Left_turn_2
+    left_turn_2_object() const {
+        return {};
+    }
+};
+
+// Times the traits' Left_turn_2 over all consecutive triples, returning the
+// number of left turns so the work cannot be optimized away.
+template <typename Traits>
+void
+bench_predicate(const std::string &name,
+                const std::vector<typename Traits::Point_2> &points) {
+    auto left_turn = Traits().left_turn_2_object();
+    std::size_t n_left = 0;
+    double t = time_seconds([&] {
+        for (std::size_t i = 0; i + 2 < points.size(); ++i) {
+            n_left += left_turn(points[i], points[i + 1], points[i + 2]);
+        }
+    });
+    std::cout << "  " << name << ": " << (points.size() - 2) / t / 1e6
+              << " M predicates/s (" << n_left << " left turns)" << std::endl;
+}
+
+template <typename Traits>
+void
+bench_hull(const std::string &name,
+           const std::vector<typename Traits::Point_2> &points) {
+    std::vector<typename Traits::Point_2> hull;
+    double t = time_seconds([&] {
+        CGAL::ch_graham_andrew(points.begin(), points.end(),
+                               std::back_inserter(hull), Traits());
+    });
+    std::cout << "  " << name << ": " << t << " s (" << hull.size()
+              << " hull points)" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+
+    // Small components: all three predicates are correct here.
+    const long long max_num = 10'000, max_den = 8;
+    auto toy_points = random_frac_points<toy::FracPoint2>(n, max_num, max_den);
+    auto points = random_frac_points<FracPoint2>(n, max_num, max_den);
+
+    std::cout << "Left_turn_2 on " << n << " points" << std::endl;
+    bench_predicate<toy::Traits>("toy Traits       ", toy_points);
+    bench_predicate<CrossFracTraits>("Frac cross()     ", points);
+    bench_predicate<ExpressionFracTraits>("cross() template ", points);
+    bench_predicate<FracTraits>("orientation()    ", points);
+
+    std::cout << "ch_graham_andrew on " << n << " points" << std::endl;
+    bench_hull<toy::Traits>("toy Traits       ", toy_points);
+    bench_hull<CrossFracTraits>("Frac cross()     ", points);
+    bench_hull<ExpressionFracTraits>("cross() template ", points);
+    bench_hull<FracTraits>("orientation()    ", points);
+
+    // Large components: building cross() as a Frac would throw
+    // std::overflow_error here, but orientation() falls back to WideInt
+    // arithmetic and stays exact, and so does the expression template
+    // version, which only asks for the sign.
+    auto wide_points =
+        random_frac_points<FracPoint2>(n, 4'000'000'000'000LL, 1'000'000'000);
+    std::cout << "large components (WideInt path)" << std::endl;
+    bench_predicate<ExpressionFracTraits>("cross() template ", wide_points);
+    bench_predicate<FracTraits>("orientation()    ", wide_points);
+    bench_hull<ExpressionFracTraits>("cross() template ", wide_points);
+    bench_hull<FracTraits>("orientation()    ", wide_points);
+
+    return 0;
+
+}
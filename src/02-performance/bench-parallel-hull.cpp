@@ -0,0 +1,74 @@
+// Times parallel_convex_hull_2() (see parallel_hull.h) with 1, 2, 4, ...
+// threads, up to the number of cores, against CGAL::convex_hull_2() on the
+// same EPICK points, and checks that every run gives exactly the same hull.
+//
+// usage: bench-parallel-hull [n_points]
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include "bench_util.h"
+#include "parallel_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 50'000'000));
+    auto points = random_points<Point_2>(Distribution::uniform_disk, n);
+
+    std::vector<Point_2> expected;
+    double sequential_t = time_seconds([&] {
+        CGAL::convex_hull_2(points.begin(), points.end(),
+                            std::back_inserter(expected));
+    });
+    std::cout << "CGAL::convex_hull_2 on " << n << " points: " << sequential_t
+              << " s (" << expected.size() << " hull points)" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    const unsigned max_threads =
+        std::max(1u, std::thread::hardware_concurrency());
+#else
+    const unsigned max_threads = 1;
+    std::cout << "(built without TBB: parallel_convex_hull_2 runs on one "
+                 "thread)" << std::endl;
+#endif
+
+    double one_thread_t = 0.0;
+    for (unsigned threads = 1;; threads = std::min(2 * threads, max_threads)) {
+#ifdef CGAL_LINKED_WITH_TBB
+        tbb::global_control control(
+            tbb::global_control::max_allowed_parallelism, threads);
+#endif
+        std::vector<Point_2> hull;
+        double t = time_seconds([&] {
+            parallel_convex_hull_2(points.begin(), points.end(),
+                                   std::back_inserter(hull));
+        });
+        if (threads == 1) {
+            one_thread_t = t;
+        }
+        std::cout << "parallel_convex_hull_2, " << threads << " threads: "
+                  << t << " s, " << sequential_t / t << "x CGAL, "
+                  << one_thread_t / t << "x 1 thread, hull "
+                  << (hull == expected ? "identical" : "DIFFERS") << std::endl;
+        if (threads == max_threads) {
+            break;
+        }
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,131 @@
+// Compares reading exact points from text through std::istringstream, as in
+// part-iii.cpp, with parsing the whole buffer in place (see frac_parse.h).
+//
+// usage: bench-parse [n_points]
+//
+// The text holds one point per line, and its coordinates are a mix of
+// quotients ("-3/7"), integers ("12") and decimals ("0.375", "-1.5e-2"), so
+// every branch of the parser is exercised.
+
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+
+#include "bench_util.h"
+#include "frac_parse.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Epeck;
+
+std::string
+random_text(std::size_t n) {
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long long> num(-1'000'000, 1'000'000);
+    std::uniform_int_distribution<long long> den(1, 1'000);
+    std::uniform_int_distribution<int> form(0, 9);
+    std::uniform_int_distribution<int> exp(-3, 3);
+
+    std::string text;
+    auto coordinate = [&] {
+        int f = form(gen);
+        if (f < 4) {
+            text += std::to_string(num(gen)) + "/" + std::to_string(den(gen));
+        } else if (f < 6) {
+            text += std::to_string(num(gen));
+        } else {
+            long long v = num(gen), a = v < 0 ? -v : v;
+            text += (v < 0 ? "-" : "") + std::to_string(a / 1000) + "." +
+                    std::to_string(1000 + a % 1000).substr(1);
+            if (f == 9) {
+                text += "e" + std::to_string(exp(gen));
+            }
+        }
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        coordinate();
+        text += ' ';
+        coordinate();
+        text += '\n';
+    }
+    return text;
+}
+
+void
+report(const std::string &name, double t, std::size_t n_bytes) {
+    std::cout << "  " << name << t << " s, " << n_bytes / t / 1e6 << " MB/s"
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+    const std::string text = random_text(n);
+    const char *first = text.data(), *last = text.data() + text.size();
+
+    std::cout << "reading " << n << " points (" << text.size() / 1e6
+              << " MB of text)" << std::endl;
+
+    std::cout << "Frac" << std::endl;
+    std::vector<FracPoint2> stream_fracs;
+    double stream_frac_t = time_seconds([&] {
+        std::istringstream in(text);
+        Frac x, y;
+        while (in >> x >> y) {
+            stream_fracs.emplace_back(x, y);
+        }
+    });
+    report("std::istringstream:  ", stream_frac_t, text.size());
+
+    std::vector<FracPoint2> fracs;
+    fracs.reserve(n);
+    std::from_chars_result frac_result{};
+    double frac_t = time_seconds([&] {
+        frac_result = parse_frac_points(first, last, std::back_inserter(fracs));
+    });
+    report("parse_frac_points(): ", frac_t, text.size());
+
+    bool same = frac_result.ec == std::errc() &&
+                fracs.size() == stream_fracs.size();
+    for (std::size_t i = 0; same && i < fracs.size(); ++i) {
+        same = fracs[i].x() == stream_fracs[i].x() &&
+               fracs[i].y() == stream_fracs[i].y();
+    }
+    std::cout << "  speed-up: " << stream_frac_t / frac_t << "x, points "
+              << (same ? "identical" : "DIFFER") << std::endl;
+
+    // This is how part-iii.cpp reads exact points.
+    std::cout << "Epeck::Point_2" << std::endl;
+    std::vector<Epeck::Point_2> stream_points;
+    double stream_point_t = time_seconds([&] {
+        std::istringstream in(text);
+        Epeck::Point_2 p;
+        while (in >> p) {
+            stream_points.push_back(p);
+        }
+    });
+    report("std::istringstream:   ", stream_point_t, text.size());
+
+    std::vector<Epeck::Point_2> points;
+    points.reserve(n);
+    std::from_chars_result point_result{};
+    double point_t = time_seconds([&] {
+        point_result =
+            parse_epeck_points(first, last, std::back_inserter(points));
+    });
+    report("parse_epeck_points(): ", point_t, text.size());
+
+    same = point_result.ec == std::errc() &&
+           points.size() == stream_points.size();
+    for (std::size_t i = 0; same && i < points.size(); ++i) {
+        same = points[i] == stream_points[i];
+    }
+    std::cout << "  speed-up: " << stream_point_t / point_t << "x, points "
+              << (same ? "identical" : "DIFFER") << std::endl;
+
+    return 0;
+
+}
@@ -0,0 +1,270 @@
+// Measures what keeping denominators positive (see frac.h) buys the
+// predicates of CGAL::ch_graham_andrew(). We count how often the hull calls
+// each predicate, then time the predicates and the hull with FracTraits and
+// with the predicates as they were before:
+//    * Less_xy_2 always cross-multiplied, and corrected the result for the
+//      signs of the denominators,
+//    * Left_turn_2 always took the general path of orientation(), again
+//      corrected for the signs of the denominators,
+//    * Equal_2 always cross-multiplied.
+//
+// usage: bench-predicates [n_points]
+
+#include <bit>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "frac_traits.h"
+
+namespace before {
+
+    int
+    compare(const Frac &a, const Frac &b) {
+        i128 lhs = static_cast<i128>(a.num()) * b.den();
+        i128 rhs = static_cast<i128>(b.num()) * a.den();
+        int s = (lhs > rhs) - (lhs < rhs);
+        return (a.den() < 0) != (b.den() < 0) ? -s : s;
+    }
+
+    bool
+    equal(const Frac &a, const Frac &b) {
+        return static_cast<i128>(a.num()) * b.den() ==
+               static_cast<i128>(b.num()) * a.den();
+    }
+
+    int
+    orientation(const FracPoint2 &p0, const FracPoint2 &p1,
+                const FracPoint2 &p2) {
+        const ll xn0 = p0.x().num(), xd0 = p0.x().den();
+        const ll yn0 = p0.y().num(), yd0 = p0.y().den();
+        const ll xn1 = p1.x().num(), xd1 = p1.x().den();
+        const ll yn1 = p1.y().num(), yd1 = p1.y().den();
+        const ll xn2 = p2.x().num(), xd2 = p2.x().den();
+        const ll yn2 = p2.y().num(), yd2 = p2.y().den();
+
+        auto mag = [](ll v) {
+            return static_cast<unsigned long long>(v < 0 ? -v : v);
+        };
+        const int bn = std::bit_width(mag(xn0) | mag(yn0) | mag(xn1) |
+                                      mag(yn1) | mag(xn2) | mag(yn2));
+        const int bd = std::bit_width(mag(xd0) | mag(yd0) | mag(xd1) |
+                                      mag(yd1) | mag(xd2) | mag(yd2));
+        if (2 * bn + 4 * bd + 3 > 127) {
+            return ::orientation(p0, p1, p2);
+        }
+
+        const int den_sign = ((xd0 < 0) ^ (xd1 < 0) ^ (xd2 < 0) ^ (yd0 < 0) ^
+                              (yd1 < 0) ^ (yd2 < 0)) ? -1 : 1;
+        i128 dx1 = static_cast<i128>(xn1) * xd0 - static_cast<i128>(xn0) * xd1;
+        i128 dy1 = static_cast<i128>(yn1) * yd0 - static_cast<i128>(yn0) * yd1;
+        i128 dx2 = static_cast<i128>(xn2) * xd0 - static_cast<i128>(xn0) * xd2;
+        i128 dy2 = static_cast<i128>(yn2) * yd0 - static_cast<i128>(yn0) * yd2;
+        i128 det = dx1 * dy2 * xd2 * yd1 - dx2 * dy1 * xd1 * yd2;
+        return den_sign * ((det > 0) - (det < 0));
+    }
+
+    class Traits : public FracTraits {
+    public:
+        class Less_xy_2 {
+        public:
+            bool
+            operator()(const Point_2 &p, const Point_2 &q) const {
+                int cx = compare(p.x(), q.x());
+                return cx < 0 || (cx == 0 && compare(p.y(), q.y()) < 0);
+            }
+        };
+
+        class Left_turn_2 {
+        public:
+            bool
+            operator()(const Point_2 &p0, const Point_2 &p1,
+                       const Point_2 &p2) const {
+                return before::orientation(p0, p1, p2) > 0;
+            }
+        };
+
+        class Equal_2 {
+        public:
+            bool
+            operator()(const Point_2 &p, const Point_2 &q) const {
+                return equal(p.x(), q.x()) && equal(p.y(), q.y());
+            }
+        };
+
+        [[nodiscard]] Less_xy_2
+        less_xy_2_object() const {
+            return {};
+        }
+
+        [[nodiscard]] Left_turn_2
+        left_turn_2_object() const {
+            return {};
+        }
+
+        [[nodiscard]] Equal_2
+        equal_2_object() const {
+            return {};
+        }
+    };
+
+}
+
+// FracTraits with a counter on every predicate. CGAL copies the traits and
+// their function objects, so they all share one Counts.
+class CountingTraits : public FracTraits {
+public:
+    struct Counts {
+        std::size_t less_xy = 0, left_turn = 0, equal = 0;
+    };
+
+    explicit CountingTraits(Counts &counts): _counts{&counts} {
+    }
+
+    class Less_xy_2 {
+    public:
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            ++counts->less_xy;
+            return FracTraits::Less_xy_2()(p, q);
+        }
+
+        Counts *counts;
+    };
+
+    class Left_turn_2 {
+    public:
+        bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            ++counts->left_turn;
+            return FracTraits::Left_turn_2()(p0, p1, p2);
+        }
+
+        Counts *counts;
+    };
+
+    class Equal_2 {
+    public:
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            ++counts->equal;
+            return FracTraits::Equal_2()(p, q);
+        }
+
+        Counts *counts;
+    };
+
+    [[nodiscard]] Less_xy_2
+    less_xy_2_object() const {
+        return {_counts};
+    }
+
+    [[nodiscard]] Left_turn_2
+    left_turn_2_object() const {
+        return {_counts};
+    }
+
+    [[nodiscard]] Equal_2
+    equal_2_object() const {
+        return {_counts};
+    }
+
+private:
+    Counts *_counts;
+};
+
+// Times Less_xy_2 and Left_turn_2 over consecutive pairs and triples of
+// points, and the whole hull, each the best of a few runs. Returns the hull.
+template <typename Traits>
+std::vector<FracPoint2>
+bench(const std::string &name, const std::vector<FracPoint2> &points) {
+    const auto less_xy = Traits().less_xy_2_object();
+    const auto left_turn = Traits().left_turn_2_object();
+
+    const int n_runs = 5;
+    std::size_t n_less = 0;
+    double less_t = best_seconds(n_runs, [&] {
+        n_less = 0;
+        for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+            n_less += less_xy(points[i], points[i + 1]);
+        }
+    });
+    std::size_t n_left = 0;
+    double left_t = best_seconds(n_runs, [&] {
+        n_left = 0;
+        for (std::size_t i = 0; i + 2 < points.size(); ++i) {
+            n_left += left_turn(points[i], points[i + 1], points[i + 2]);
+        }
+    });
+    std::vector<FracPoint2> hull;
+    double hull_t = best_seconds(n_runs, [&] {
+        hull.clear();
+        CGAL::ch_graham_andrew(points.begin(), points.end(),
+                               std::back_inserter(hull), Traits());
+    });
+
+    std::cout << "  " << name << ": Less_xy_2 "
+              << (points.size() - 1) / less_t / 1e6 << " M/s, Left_turn_2 "
+              << (points.size() - 2) / left_t / 1e6 << " M/s, hull "
+              << hull_t << " s (" << n_less << " less, " << n_left
+              << " left turns)" << std::endl;
+    return hull;
+}
+
+void
+run(const std::string &name, const std::vector<FracPoint2> &points) {
+    CountingTraits::Counts counts;
+    std::vector<FracPoint2> hull;
+    CGAL::ch_graham_andrew(points.begin(), points.end(),
+                           std::back_inserter(hull), CountingTraits(counts));
+
+    std::cout << name << " (" << points.size() << " points, " << hull.size()
+              << " hull points)" << std::endl;
+    std::cout << "  predicate mix: " << counts.less_xy << " Less_xy_2, "
+              << counts.left_turn << " Left_turn_2, " << counts.equal
+              << " Equal_2" << std::endl;
+
+    auto before_hull = bench<before::Traits>("before", points);
+    auto after_hull = bench<FracTraits>("after ", points);
+
+    auto equal = FracTraits().equal_2_object();
+    bool same = before_hull.size() == after_hull.size();
+    for (std::size_t i = 0; same && i < after_hull.size(); ++i) {
+        same = equal(before_hull[i], after_hull[i]);
+    }
+    std::cout << "  hulls " << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+// Random points whose coordinates are multiples of 1 / den.
+std::vector<FracPoint2>
+grid_points(std::size_t n, long long max_num, long long den) {
+    std::vector<FracPoint2> points;
+    points.reserve(n);
+    for (const FracPoint2 &p : random_frac_points<FracPoint2>(n, max_num, 1)) {
+        points.emplace_back(Frac(p.x().num(), den), Frac(p.y().num(), den));
+    }
+    return points;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    // Every denominator is 1: the integer fast paths apply throughout.
+    run("integer points", random_frac_points<FracPoint2>(n, 1'000'000, 1));
+
+    // Points on a grid of step 1/1024. After reduction the denominators are
+    // powers of two, equal for some pairs of points and not for others.
+    run("grid points", grid_points(n, 1'000'000, 1024));
+
+    // Small random fractions.
+    run("small fractions", random_frac_points<FracPoint2>(n, 10'000, 8));
+
+    return 0;
+
+}
@@ -0,0 +1,89 @@
+// Measures Akl_toussaint_prefilter (see hull_prefilter.h) in front of the
+// Graham-Andrew algorithm, for EPICK points, the FracTraits of frac_traits.h
+// and the toy Traits of part-vii.cpp, on the distributions of
+// point_generators.h. For each we report how many points the prefilter
+// discarded, the times with and without it, and whether the hulls agree.
+//
+// usage: bench-prefilter [n_points]
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "frac_traits.h"
+#include "hull_algorithms.h"
+#include "point_generators.h"
+#include "toy_frac.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+
+template <typename Traits>
+void
+bench(const std::string &name,
+      const std::vector<typename Traits::Point_2> &points) {
+    using Point_2 = typename Traits::Point_2;
+    auto equal = Traits().equal_2_object();
+
+    std::vector<Point_2> hull;
+    double t = time_seconds([&] {
+        hull_2(points.begin(), points.end(), std::back_inserter(hull),
+               Traits());
+    });
+
+    std::vector<Point_2> filtered_hull;
+    Prefilter_statistics statistics;
+    double filtered_t = time_seconds([&] {
+        hull_2<Akl_toussaint_prefilter>(points.begin(), points.end(),
+                                        std::back_inserter(filtered_hull),
+                                        Traits(), &statistics);
+    });
+
+    bool same = hull.size() == filtered_hull.size();
+    for (std::size_t i = 0; same && i < hull.size(); ++i) {
+        same = equal(hull[i], filtered_hull[i]);
+    }
+
+    std::cout << "  " << name << ": " << points.size() << " points, "
+              << 100.0 * statistics.n_discarded / statistics.n_input
+              << "% discarded, " << t << " s -> " << filtered_t << " s ("
+              << t / filtered_t << "x), hulls "
+              << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    for (Distribution distribution : all_distributions) {
+        std::cout << distribution_name(distribution) << std::endl;
+
+        bench<Kernel>("EPICK     ",
+                      random_points<Kernel::Point_2>(distribution, n));
+
+        // Fractions with denominator 1024 keep FracTraits on its fast
+        // __int128 paths.
+        bench<FracTraits>("FracTraits", random_points<FracPoint2>(
+            distribution, n, [](double x, double y) {
+                return FracPoint2(Frac(std::llround(x * 1024 * 1024), 1024),
+                                  Frac(std::llround(y * 1024 * 1024), 1024));
+            }));
+
+        // The toy fractions overflow on large components, so we keep them
+        // as small as in bench-frac.cpp, and the toy Traits are slow, so we
+        // use fewer points.
+        bench<toy::Traits>("toy Traits", random_points<toy::FracPoint2>(
+            distribution, n / 10, [](double x, double y) {
+                return toy::FracPoint2(toy::Frac(std::llround(x * 8000), 8),
+                                       toy::Frac(std::llround(y * 8000), 8));
+            }));
+    }
+
+    return 0;
+
+}
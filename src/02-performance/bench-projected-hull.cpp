@@ -0,0 +1,118 @@
+// Computes the silhouettes of the OFF meshes in a directory, meshes/ by
+// default, projected on to the xy-, yz- and xz-planes, straight from the
+// vertex point map of a CGAL::Surface_mesh with projected_convex_hull_2()
+// (see projected_hull.h), and as in part-vi.cpp, by copying the points into a
+// std::vector first. Reports the time per mesh of both, and checks that the
+// silhouettes agree. Meshes that CGAL::IO::read_polygon_mesh() cannot read
+// are listed as skipped.
+//
+// usage: bench-projected-hull [mesh_directory]
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Projection_traits_xy_3.h>
+#include <CGAL/Projection_traits_xz_3.h>
+#include <CGAL/Projection_traits_yz_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "projected_hull.h"
+
+#ifndef CGAL_TUTORIAL_MESHES_DIR
+#define CGAL_TUTORIAL_MESHES_DIR "meshes"
+#endif
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+
+// Times one projection of mesh, in microseconds, adds the times to the
+// totals, and prints them.
+template <typename Traits>
+void
+bench(const Mesh &mesh, const Traits &traits, double &projected_total,
+      double &copy_total) {
+    std::vector<Point_3> silhouette;
+    double projected_t = best_seconds(5, [&] {
+        silhouette.clear();
+        projected_convex_hull_2(mesh, std::back_inserter(silhouette), traits);
+    });
+
+    std::vector<Point_3> expected;
+    double copy_t = best_seconds(5, [&] {
+        expected.clear();
+        std::vector<Point_3> points(mesh.points().begin(),
+                                    mesh.points().end());
+        CGAL::convex_hull_2(points.begin(), points.end(),
+                            std::back_inserter(expected), traits);
+    });
+
+    projected_total += projected_t;
+    copy_total += copy_t;
+    std::cout << "\t" << silhouette.size() << "\t" << projected_t * 1e6
+              << "\t" << copy_t * 1e6
+              << (silhouette == expected ? "" : " DIFFER");
+}
+
+int main(int argc, char *argv[]) {
+
+    const std::filesystem::path directory =
+        argc > 1 ? argv[1] : CGAL_TUTORIAL_MESHES_DIR;
+
+    std::vector<std::filesystem::path> paths;
+    for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".off") {
+            paths.push_back(entry.path());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::cout << "times in microseconds: silhouette size, projected, copied"
+              << std::endl;
+    std::cout << "mesh\tvertices\txy\t\t\tyz\t\t\txz" << std::endl;
+    std::size_t n_meshes = 0, n_vertices = 0;
+    double projected_total = 0.0, copy_total = 0.0;
+    std::vector<std::string> skipped;
+    for (const auto &path : paths) {
+        Mesh mesh;
+        if (!CGAL::IO::read_polygon_mesh(path.string(), mesh) ||
+            mesh.is_empty()) {
+            skipped.push_back(path.filename().string());
+            continue;
+        }
+        ++n_meshes;
+        n_vertices += mesh.number_of_vertices();
+        std::cout << path.stem().string() << "\t"
+                  << mesh.number_of_vertices();
+        bench(mesh, CGAL::Projection_traits_xy_3<Kernel>(), projected_total,
+              copy_total);
+        bench(mesh, CGAL::Projection_traits_yz_3<Kernel>(), projected_total,
+              copy_total);
+        bench(mesh, CGAL::Projection_traits_xz_3<Kernel>(), projected_total,
+              copy_total);
+        std::cout << std::endl;
+    }
+
+    std::cout << n_meshes << " meshes, " << n_vertices << " vertices, 3 "
+              << "projections each: projected " << projected_total * 1e3
+              << " ms, copied " << copy_total * 1e3 << " ms, "
+              << copy_total / projected_total << "x" << std::endl;
+    if (!skipped.empty()) {
+        std::cout << "skipped " << skipped.size() << ":";
+        for (const auto &name : skipped) {
+            std::cout << " " << name;
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+
+}
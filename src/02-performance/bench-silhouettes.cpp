@@ -0,0 +1,116 @@
+// Computes the silhouettes of random 3D points seen from K directions - the
+// three axis planes, and the 26 directions of cube_view_directions() - with
+// one CGAL::convex_hull_2() call per direction, and with silhouettes_2()
+// (see silhouettes.h), and reports how many points times directions each
+// gets through per second. The points are uniform in the unit ball, where
+// few are on the silhouettes, and on the unit sphere, where many more are.
+// The silhouettes of silhouettes_2() are checked against those of the
+// independent calls.
+//
+// usage: bench-silhouettes [n_points]
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Projection_traits_3.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "silhouettes.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef Kernel::Vector_3 Vector_3;
+
+// n random points uniform in the unit ball, or on the unit sphere.
+std::vector<Point_3>
+random_points_3(std::size_t n, bool on_sphere) {
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<Point_3> points;
+    points.reserve(n);
+    while (points.size() < n) {
+        double x = uniform(gen), y = uniform(gen), z = uniform(gen);
+        double r2 = x * x + y * y + z * z;
+        if (r2 > 1.0 || r2 == 0.0) {
+            continue;
+        }
+        if (on_sphere) {
+            const double r = std::sqrt(r2);
+            x /= r;
+            y /= r;
+            z /= r;
+        }
+        points.emplace_back(x, y, z);
+    }
+    return points;
+}
+
+void
+bench(const std::vector<Point_3> &points, const std::string &name,
+      const std::vector<Vector_3> &normals) {
+    const double work = static_cast<double>(points.size()) * normals.size();
+
+    std::vector<std::vector<Point_3>> expected(normals.size());
+    double independent_t = best_seconds(3, [&] {
+        for (std::size_t d = 0; d < normals.size(); ++d) {
+            expected[d].clear();
+            CGAL::convex_hull_2(points.begin(), points.end(),
+                                std::back_inserter(expected[d]),
+                                CGAL::Projection_traits_3<Kernel>(normals[d]));
+        }
+    });
+
+    std::vector<std::vector<Point_3>> silhouettes;
+    double together_t = best_seconds(3, [&] {
+        silhouettes_2(points.begin(), points.end(), normals, silhouettes);
+    });
+
+    std::size_t n_hull_points = 0;
+    for (const auto &hull : expected) {
+        n_hull_points += hull.size();
+    }
+    std::cout << "  " << name << ", K = " << normals.size() << ", "
+              << n_hull_points << " silhouette points" << std::endl;
+    std::cout << "    " << normals.size() << " x convex_hull_2:  "
+              << independent_t << " s, " << work / independent_t * 1e-6
+              << " M point-directions/s" << std::endl;
+    std::cout << "    silhouettes_2:       " << together_t << " s, "
+              << work / together_t * 1e-6 << " M point-directions/s, "
+              << independent_t / together_t << "x, silhouettes "
+              << (silhouettes == expected ? "identical" : "DIFFER")
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 1'000'000));
+
+    // The axis planes of Projection_traits_xy_3, _yz_3 and _xz_3.
+    const std::vector<Vector_3> axes = {
+        {0, 0, 1}, {1, 0, 0}, {0, -1, 0}
+    };
+    const auto cube = cube_view_directions<Vector_3>();
+
+#ifdef CGAL_LINKED_WITH_TBB
+    std::cout << std::thread::hardware_concurrency() << " threads, ";
+#else
+    std::cout << "1 thread, ";
+#endif
+    std::cout << n << " points" << std::endl;
+    for (bool on_sphere : {false, true}) {
+        auto points = random_points_3(n, on_sphere);
+        const std::string name = on_sphere ? "on sphere" : "in ball";
+        bench(points, name, axes);
+        bench(points, name, cube);
+    }
+
+    return 0;
+
+}
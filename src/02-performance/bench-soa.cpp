@@ -0,0 +1,105 @@
+// Compares the hulls of points stored as a std::vector<Point_2>, as in the
+// examples, with those of the same points in a PointSoA2 (see point_soa_2.h):
+//    * CGAL::ch_graham_andrew() and CGAL::convex_hull_2() on the vector, and
+//      on the indices of the PointSoA2 with PointSoA2_traits,
+//    * hull_2() with the Akl_toussaint_prefilter of hull_prefilter.h on the
+//      vector, against soa_convex_hull_2(), which runs the same throw-away
+//      step as a sweep over the coordinate arrays.
+// We report millions of input points per second; the points are converted
+// before the clock starts. The sweep uses AVX2 when the compiler targets it,
+// e.g. with -DCMAKE_CXX_FLAGS=-mavx2.
+//
+// usage: bench-soa [n_points]
+
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "hull_algorithms.h"
+#include "point_generators.h"
+#include "point_soa_2.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+template <typename F>
+void
+report(const std::string &name, std::size_t n, F &&f) {
+    double t = best_seconds(3, f);
+    std::cout << "  " << name << n / t * 1e-6 << " Mpoints/s" << std::endl;
+}
+
+void
+bench(Distribution distribution, std::size_t n) {
+    auto points = random_points<Point_2>(distribution, n);
+    PointSoA2<Kernel> soa(points.begin(), points.end());
+    std::vector<std::size_t> indices(n);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+
+    std::vector<Point_2> hull;
+    std::vector<std::size_t> soa_hull;
+    auto aos = [&](auto hull_function) {
+        return [&, hull_function] {
+            hull.clear();
+            hull_function(points.begin(), points.end(),
+                          std::back_inserter(hull));
+        };
+    };
+    auto soa_indices = [&](auto hull_function) {
+        return [&, hull_function] {
+            soa_hull.clear();
+            hull_function(indices.begin(), indices.end(),
+                          std::back_inserter(soa_hull));
+        };
+    };
+
+    std::cout << distribution_name(distribution) << " (" << n << " points)"
+              << std::endl;
+    report("AoS ch_graham_andrew:          ", n, aos([](auto... args) {
+        return CGAL::ch_graham_andrew(args..., Kernel());
+    }));
+    report("SoA ch_graham_andrew:          ", n, soa_indices([&](auto... args) {
+        return CGAL::ch_graham_andrew(args..., soa.traits());
+    }));
+    report("AoS convex_hull_2:             ", n, aos([](auto... args) {
+        return CGAL::convex_hull_2(args..., Kernel());
+    }));
+    report("SoA convex_hull_2:             ", n, soa_indices([&](auto... args) {
+        return CGAL::convex_hull_2(args..., soa.traits());
+    }));
+    report("AoS hull_2<Akl_toussaint_...>: ", n, aos([](auto... args) {
+        return hull_2<Akl_toussaint_prefilter>(args..., Kernel());
+    }));
+    report("SoA soa_convex_hull_2:         ", n, [&] {
+        soa_hull.clear();
+        soa_convex_hull_2(soa, std::back_inserter(soa_hull));
+    });
+
+    std::vector<Point_2> expected;
+    CGAL::ch_graham_andrew(points.begin(), points.end(),
+                           std::back_inserter(expected));
+    std::vector<Point_2> from_soa;
+    for (std::size_t i : soa_hull) {
+        from_soa.push_back(soa.point(i));
+    }
+    std::cout << "  hulls " << (from_soa == expected ? "identical" : "DIFFER")
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    for (Distribution distribution : all_distributions) {
+        bench(distribution, n);
+    }
+
+    return 0;
+
+}
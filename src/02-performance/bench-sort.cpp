@@ -0,0 +1,86 @@
+// Compares std::sort() with FracTraits::Less_xy_2 against sort_xy() (see
+// frac_sort.h), on its own and as the sort phase of the Graham-Andrew hull.
+//
+// usage: bench-sort [n_points]
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "frac_sort.h"
+
+void
+bench(const std::string &name, const std::vector<FracPoint2> &points) {
+    const auto less_xy = FracTraits().less_xy_2_object();
+    const auto equal = FracTraits().equal_2_object();
+
+    std::vector<FracPoint2> expected = points;
+    double sort_t = time_seconds([&] {
+        std::sort(expected.begin(), expected.end(), less_xy);
+    });
+
+    std::vector<FracPoint2> sorted = points;
+    double sort_xy_t = time_seconds([&] {
+        sort_xy(sorted);
+    });
+
+    // Equal points may come out in a different order, but they are equal.
+    bool same = true;
+    for (std::size_t i = 0; same && i < sorted.size(); ++i) {
+        same = equal(sorted[i], expected[i]);
+    }
+
+    std::vector<FracPoint2> hull;
+    double hull_t = time_seconds([&] {
+        CGAL::ch_graham_andrew(points.begin(), points.end(),
+                               std::back_inserter(hull), FracTraits());
+    });
+
+    std::vector<FracPoint2> fast_hull;
+    double fast_hull_t = time_seconds([&] {
+        frac_ch_graham_andrew(points.begin(), points.end(),
+                              std::back_inserter(fast_hull));
+    });
+
+    bool same_hull = hull.size() == fast_hull.size();
+    for (std::size_t i = 0; same_hull && i < hull.size(); ++i) {
+        same_hull = equal(hull[i], fast_hull[i]);
+    }
+
+    std::cout << name << " (" << points.size() << " points)" << std::endl;
+    std::cout << "  std::sort(Less_xy_2):   " << sort_t << " s" << std::endl;
+    std::cout << "  sort_xy():              " << sort_xy_t << " s, "
+              << sort_t / sort_xy_t << "x, order "
+              << (same ? "identical" : "DIFFERS") << std::endl;
+    std::cout << "  ch_graham_andrew():      " << hull_t << " s" << std::endl;
+    std::cout << "  frac_ch_graham_andrew(): " << fast_hull_t << " s, "
+              << hull_t / fast_hull_t << "x, hulls "
+              << (same_hull ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 10'000'000));
+
+    bench("small components", random_frac_points<FracPoint2>(n, 10'000, 8));
+
+    // Few distinct values: long runs of equal keys.
+    bench("integer grid", random_frac_points<FracPoint2>(n, 100, 1));
+
+    // Components up to 2^40: the keys are still exact, but neighbouring
+    // fractions are much closer together.
+    bench("large components",
+          random_frac_points<FracPoint2>(n, 1LL << 40, 1LL << 40));
+
+    // Components beyond 2^53: sort_xy() falls back to std::sort().
+    bench("huge components",
+          random_frac_points<FracPoint2>(n / 10, 1LL << 60, 1LL << 60));
+
+    return 0;
+
+}
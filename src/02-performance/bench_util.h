@@ -0,0 +1,68 @@
+#ifndef CGAL_TUTORIAL_BENCH_UTIL_H
+#define CGAL_TUTORIAL_BENCH_UTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Small helpers shared by the benchmarks in this directory.
+
+// Runs f once and returns the elapsed wall-clock time in seconds.
+template <typename F>
+double
+time_seconds(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+// Runs f n times and returns the shortest of the elapsed times, which is less
+// sensitive to other load on the machine than a single run.
+template <typename F>
+double
+best_seconds(int n, F &&f) {
+    double best = time_seconds(f);
+    for (int i = 1; i < n; ++i) {
+        best = std::min(best, time_seconds(f));
+    }
+    return best;
+}
+
+// Reads the i-th command line argument as an integer, or returns a default if
+// it was not given.
+inline long long
+arg_or(int argc, char *argv[], int i, long long fallback) {
+    return i < argc ? std::atoll(argv[i]) : fallback;
+}
+
+// Creates n random points with fractional coordinates num/den, where num is
+// drawn from [-max_num, max_num] and den from [1, max_den]. The Point type only
+// has to be constructible from two {num, den} pairs, so this works for both
+// the toy FracPoint2 of part-vii.cpp and the one in frac_point_2.h.
+template <typename Point>
+std::vector<Point>
+random_frac_points(std::size_t n, long long max_num, long long max_den,
+                   std::uint64_t seed = 42) {
+    using F = std::decay_t<decltype(std::declval<const Point &>().x())>;
+
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<long long> num(-max_num, max_num);
+    std::uniform_int_distribution<long long> den(1, max_den);
+
+    std::vector<Point> points;
+    points.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        long long xn = num(gen), xd = den(gen);
+        long long yn = num(gen), yd = den(gen);
+        points.emplace_back(F{xn, xd}, F{yn, yd});
+    }
+    return points;
+}
+
+#endif //CGAL_TUTORIAL_BENCH_UTIL_H
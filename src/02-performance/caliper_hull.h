@@ -0,0 +1,397 @@
+#ifndef CGAL_TUTORIAL_CALIPER_HULL_H
+#define CGAL_TUTORIAL_CALIPER_HULL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+// Once we have the hull of part-iv.cpp or part-v.cpp we often want to measure
+// it: its diameter, its width, the smallest rectangles around it, or all its
+// antipodal pairs - the pairs of vertices that admit parallel supporting
+// lines. Each is easily found by trying all pairs of vertices, or all edges
+// against all vertices, in O(h^2) for h hull vertices.
+//
+// CaliperHull keeps the hull counterclockwise in one std::vector and answers
+// all of them in O(h) with Shamos' rotating calipers. We walk along the
+// edges, and for every edge keep three pointers to the vertices that are
+// extreme with respect to it: the farthest from its line, and the first and
+// last in its direction. As the edge turns counterclockwise each of them only
+// ever moves forward, so all the pointers together make O(h) steps.
+//    * The antipodal pairs are the two ends of every edge with the vertex
+//      farthest from it, and with its neighbour too if that ties.
+//    * The diameter is the farthest antipodal pair.
+//    * The width is the smallest distance of a vertex from its edge.
+//    * The smallest rectangles, by area or by perimeter, have a side on an
+//      edge of the hull, and touch the three extreme vertices.
+// measure() runs one sweep for whichever of them are asked for together:
+//
+//    CaliperHull<Kernel> hull(points.begin(), points.end());
+//    auto results = hull.measure(CaliperHull<Kernel>::DIAMETER |
+//                                CaliperHull<Kernel>::MIN_AREA_RECTANGLE);
+//    results.diameter->squared_length ...
+//
+// Everything is computed from the coordinates with Kernel::FT, so the
+// results are exact for an exact kernel such as EPECK, and accurate to
+// rounding for EPICK. Only Kernel::FT, Kernel::Point_2 with x(), y() and a
+// constructor from two FTs, and what CGAL::convex_hull_2() needs are used.
+
+template <typename Kernel>
+class CaliperHull {
+public:
+
+    using FT = typename Kernel::FT;
+    using Point_2 = typename Kernel::Point_2;
+
+    // The queries of measure(), to be or-ed together.
+    enum Query : unsigned {
+        ANTIPODAL_PAIRS = 1 << 0,
+        DIAMETER = 1 << 1,
+        WIDTH = 1 << 2,
+        MIN_AREA_RECTANGLE = 1 << 3,
+        MIN_PERIMETER_RECTANGLE = 1 << 4,
+        ALL = (1 << 5) - 1
+    };
+
+    // Two hull vertices, by index, at the largest distance.
+    struct Diameter {
+        std::size_t first = 0;
+        std::size_t second = 0;
+        FT squared_length = FT(0);
+    };
+
+    // The edge from vertex edge to vertex edge + 1 and the vertex farthest
+    // from its line, for the edge where that distance is smallest.
+    struct Width {
+        std::size_t edge = 0;
+        std::size_t vertex = 0;
+        FT squared_width = FT(0);
+    };
+
+    // A rectangle around the hull with a side on the edge from vertex edge to
+    // vertex edge + 1. The corners are counterclockwise, from the one on the
+    // line of the edge that is first in its direction.
+    struct Rectangle {
+        std::size_t edge = 0;
+        std::array<Point_2, 4> corners;
+        FT area = FT(0);
+        FT squared_perimeter = FT(0);
+    };
+
+    // What measure() found; only the queries asked for are set.
+    struct Results {
+        std::optional<std::vector<std::pair<std::size_t, std::size_t>>>
+            antipodal_pairs;
+        std::optional<Diameter> diameter;
+        std::optional<Width> width;
+        std::optional<Rectangle> min_area_rectangle;
+        std::optional<Rectangle> min_perimeter_rectangle;
+    };
+
+    explicit CaliperHull(const Kernel &kernel = Kernel()): _kernel{kernel} {
+    }
+
+    // The hull of the points in [first, last).
+    template <typename InputIterator>
+    CaliperHull(InputIterator first, InputIterator last,
+                const Kernel &kernel = Kernel())
+        : _kernel{kernel} {
+        CGAL::convex_hull_2(first, last, std::back_inserter(_hull), _kernel);
+    }
+
+    // Takes a hull as CGAL::convex_hull_2() writes it: counterclockwise,
+    // without repeated or collinear vertices.
+    template <typename InputIterator>
+    static CaliperHull
+    from_hull(InputIterator first, InputIterator last,
+              const Kernel &kernel = Kernel()) {
+        CaliperHull hull(kernel);
+        hull._hull.assign(first, last);
+        return hull;
+    }
+
+    [[nodiscard]] const std::vector<Point_2> &
+    points() const {
+        return _hull;
+    }
+
+    [[nodiscard]] std::size_t
+    size() const {
+        return _hull.size();
+    }
+
+    [[nodiscard]] const Point_2 &
+    operator[](std::size_t i) const {
+        return _hull[i];
+    }
+
+    // Answers the queries, with one sweep. Nothing is set for an empty
+    // hull.
+    Results
+    measure(unsigned queries) const;
+
+    // The single queries. The hull must not be empty.
+
+    [[nodiscard]] std::vector<std::pair<std::size_t, std::size_t>>
+    antipodal_pairs() const {
+        return *measure(ANTIPODAL_PAIRS).antipodal_pairs;
+    }
+
+    [[nodiscard]] Diameter
+    diameter() const {
+        return *measure(DIAMETER).diameter;
+    }
+
+    [[nodiscard]] Width
+    width() const {
+        return *measure(WIDTH).width;
+    }
+
+    [[nodiscard]] Rectangle
+    min_area_rectangle() const {
+        return *measure(MIN_AREA_RECTANGLE).min_area_rectangle;
+    }
+
+    [[nodiscard]] Rectangle
+    min_perimeter_rectangle() const {
+        return *measure(MIN_PERIMETER_RECTANGLE).min_perimeter_rectangle;
+    }
+
+private:
+
+    [[nodiscard]] std::size_t
+    next(std::size_t i) const {
+        return i + 1 == _hull.size() ? 0 : i + 1;
+    }
+
+    [[nodiscard]] std::size_t
+    previous(std::size_t i) const {
+        return i == 0 ? _hull.size() - 1 : i - 1;
+    }
+
+    // The cross and dot products of the edge from _hull[i] to _hull[next(i)]
+    // with _hull[j] - _hull[i]. The cross product is positive for the
+    // vertices to the left of the edge, which is all of them.
+    [[nodiscard]] FT
+    cross(std::size_t i, std::size_t j) const {
+        const Point_2 &a = _hull[i], &b = _hull[next(i)], &c = _hull[j];
+        return (b.x() - a.x()) * (c.y() - a.y()) -
+               (b.y() - a.y()) * (c.x() - a.x());
+    }
+
+    [[nodiscard]] FT
+    dot(std::size_t i, std::size_t j) const {
+        const Point_2 &a = _hull[i], &b = _hull[next(i)], &c = _hull[j];
+        return (b.x() - a.x()) * (c.x() - a.x()) +
+               (b.y() - a.y()) * (c.y() - a.y());
+    }
+
+    [[nodiscard]] FT
+    squared_distance(std::size_t i, std::size_t j) const {
+        const FT dx = _hull[i].x() - _hull[j].x();
+        const FT dy = _hull[i].y() - _hull[j].y();
+        return dx * dx + dy * dy;
+    }
+
+    // The rectangle on edge i whose sides touch the vertices first and last
+    // in its direction at dot products low and high, and the farthest from
+    // it at cross product height.
+    [[nodiscard]] Rectangle
+    rectangle(std::size_t i, const FT &low, const FT &high,
+              const FT &height) const;
+
+    Kernel _kernel;
+    std::vector<Point_2> _hull;
+};
+
+template <typename Kernel>
+typename CaliperHull<Kernel>::Results
+CaliperHull<Kernel>::measure(unsigned queries) const {
+    Results results;
+    const std::size_t h = _hull.size();
+    if (h == 0) {
+        return results;
+    }
+    if (h == 1) {
+        if (queries & ANTIPODAL_PAIRS) {
+            results.antipodal_pairs.emplace();
+        }
+        if (queries & DIAMETER) {
+            results.diameter = Diameter{};
+        }
+        if (queries & WIDTH) {
+            results.width = Width{};
+        }
+        Rectangle point;
+        point.corners.fill(_hull[0]);
+        if (queries & MIN_AREA_RECTANGLE) {
+            results.min_area_rectangle = point;
+        }
+        if (queries & MIN_PERIMETER_RECTANGLE) {
+            results.min_perimeter_rectangle = point;
+        }
+        return results;
+    }
+
+    const bool rectangles =
+        queries & (MIN_AREA_RECTANGLE | MIN_PERIMETER_RECTANGLE);
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    Diameter diameter;
+    Width width;
+    // The best rectangles so far, by edge, and their measures times the
+    // squared length of their edge, which we compare without dividing.
+    std::size_t area_edge = 0, perimeter_edge = 0;
+    FT area_low, area_high, area_height, perimeter_low, perimeter_high,
+       perimeter_height;
+    FT best_area(0), best_perimeter(0), best_length(0);
+
+    // The extreme vertices of edge 0: the farthest from its line, and the
+    // first and last in its direction. From there on they only move forward.
+    std::size_t top = 0, low = 0, high = 0;
+    for (std::size_t j = 1; j < h; ++j) {
+        if (cross(0, j) > cross(0, top)) {
+            top = j;
+        }
+        if (dot(0, j) < dot(0, low)) {
+            low = j;
+        }
+        if (dot(0, j) > dot(0, high)) {
+            high = j;
+        }
+    }
+
+    auto consider_pair = [&](std::size_t a, std::size_t b) {
+        if (a == b) {
+            return;
+        }
+        if (queries & ANTIPODAL_PAIRS) {
+            pairs.emplace_back(std::min(a, b), std::max(a, b));
+        }
+        if (queries & DIAMETER) {
+            const FT d = squared_distance(a, b);
+            if (d > diameter.squared_length) {
+                diameter = {std::min(a, b), std::max(a, b), d};
+            }
+        }
+    };
+
+    for (std::size_t i = 0; i < h; ++i) {
+        // Each pointer stops at the first vertex where the next one is not
+        // better; there are no ties before the extreme, as the hull has no
+        // collinear vertices.
+        for (std::size_t step = 0; step < h && cross(i, next(top)) >
+                                               cross(i, top); ++step) {
+            top = next(top);
+        }
+        const FT height = cross(i, top);
+        const FT length = dot(i, next(i));
+
+        if (queries & (ANTIPODAL_PAIRS | DIAMETER)) {
+            consider_pair(i, top);
+            consider_pair(next(i), top);
+            // An edge parallel to edge i: both its ends are antipodal to
+            // both ends of edge i. The pointer is on one of them.
+            for (std::size_t j : {next(top), previous(top)}) {
+                if (cross(i, j) == height) {
+                    consider_pair(i, j);
+                    consider_pair(next(i), j);
+                }
+            }
+        }
+
+        // height^2 / length is the squared width at edge i.
+        if ((queries & WIDTH) &&
+            (i == 0 || height * height * best_length <
+                       width.squared_width * length)) {
+            width = {i, top, height * height};
+            best_length = length;
+        }
+
+        if (rectangles) {
+            for (std::size_t step = 0; step < h && dot(i, next(high)) >
+                                                   dot(i, high); ++step) {
+                high = next(high);
+            }
+            for (std::size_t step = 0; step < h && dot(i, next(low)) <
+                                                   dot(i, low); ++step) {
+                low = next(low);
+            }
+            const FT low_dot = dot(i, low), high_dot = dot(i, high);
+            // The area is (high - low) height / length and the squared
+            // perimeter 4 (high - low + height)^2 / length; we compare them
+            // times the length of the best edge so far.
+            const FT area = (high_dot - low_dot) * height;
+            const FT sides = high_dot - low_dot + height;
+            const FT perimeter = sides * sides;
+            if (i == 0 || area * dot(area_edge, next(area_edge)) <
+                          best_area * length) {
+                area_edge = i;
+                best_area = area;
+                area_low = low_dot;
+                area_high = high_dot;
+                area_height = height;
+            }
+            if (i == 0 || perimeter * dot(perimeter_edge,
+                                          next(perimeter_edge)) <
+                          best_perimeter * length) {
+                perimeter_edge = i;
+                best_perimeter = perimeter;
+                perimeter_low = low_dot;
+                perimeter_high = high_dot;
+                perimeter_height = height;
+            }
+        }
+    }
+
+    if (queries & ANTIPODAL_PAIRS) {
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+        results.antipodal_pairs = std::move(pairs);
+    }
+    if (queries & DIAMETER) {
+        results.diameter = diameter;
+    }
+    if (queries & WIDTH) {
+        width.squared_width = width.squared_width / best_length;
+        results.width = width;
+    }
+    if (queries & MIN_AREA_RECTANGLE) {
+        results.min_area_rectangle =
+            rectangle(area_edge, area_low, area_high, area_height);
+    }
+    if (queries & MIN_PERIMETER_RECTANGLE) {
+        results.min_perimeter_rectangle = rectangle(
+            perimeter_edge, perimeter_low, perimeter_high, perimeter_height);
+    }
+    return results;
+}
+
+template <typename Kernel>
+typename CaliperHull<Kernel>::Rectangle
+CaliperHull<Kernel>::rectangle(std::size_t i, const FT &low, const FT &high,
+                               const FT &height) const {
+    const Point_2 &a = _hull[i], &b = _hull[next(i)];
+    const FT ex = b.x() - a.x(), ey = b.y() - a.y();
+    const FT length = ex * ex + ey * ey;
+    // Along the edge by t, and to its left by s, both in units of length.
+    auto corner = [&](const FT &t, const FT &s) {
+        return Point_2(a.x() + (t * ex - s * ey) / length,
+                       a.y() + (t * ey + s * ex) / length);
+    };
+    Rectangle r;
+    r.edge = i;
+    r.corners = {corner(low, FT(0)), corner(high, FT(0)),
+                 corner(high, height), corner(low, height)};
+    r.area = (high - low) * height / length;
+    const FT sides = high - low + height;
+    r.squared_perimeter = FT(4) * sides * sides / length;
+    return r;
+}
+
+#endif //CGAL_TUTORIAL_CALIPER_HULL_H
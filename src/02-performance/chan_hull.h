@@ -0,0 +1,189 @@
+#ifndef CGAL_TUTORIAL_CHAN_HULL_H
+#define CGAL_TUTORIAL_CHAN_HULL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <CGAL/Kernel_traits.h>
+
+// Chan's output-sensitive algorithm: O(n log h) for n points with h hull
+// vertices, rather than the O(n log n) of sorting all the points as
+// CGAL::ch_graham_andrew() does. When h is tiny and n is huge, that is the
+// difference between log(100) and log(100M).
+//
+// The algorithm guesses a bound m >= h, cuts the points into groups of m,
+// and computes the hull of every group (by sorting the group, O(n log m) in
+// total). It then wraps around the whole set as in the Jarvis march, but
+// finds the next hull vertex among the group hulls by binary search, O(log m)
+// per group and step. If the march has not finished after m steps, the guess
+// was too small, and it starts again with m squared, keeping only the
+// vertices of the group hulls (the others cannot be on the hull). The
+// guesses grow so fast that the total is O(n log h).
+//
+// Like ch_graham_andrew(), ch_chan() only needs Less_xy_2, Left_turn_2 and
+// Equal_2 from its traits, i.e. the ConvexHullTraits_2 requirements listed in
+// part-vi.cpp, so it works with the Traits of part-vii.cpp and with
+// CGAL::Projection_traits_yz_3. We march along the lower hull from the
+// smallest point to the largest and then along the upper hull back, with the
+// group hulls kept as lower and upper monotone chains: on a chain, the points
+// after the current vertex form a convex sequence seen from below, so the
+// tangent is where the chain first turns left. The output is the same as
+// that of ch_graham_andrew(): counterclockwise from the smallest point, with
+// no duplicate or collinear points.
+
+namespace chan_internal {
+
+    // The chains of all the groups, stored one after the other: group g's
+    // chain is points[start[g], start[g + 1]).
+    template <typename Point>
+    struct Chains {
+        std::vector<Point> points;
+        std::vector<std::size_t> start{0};
+    };
+
+    // Appends the monotone chain of the sorted range [first, last) - left
+    // turns only, as in hull_chains.h - to chains.
+    template <typename Iterator, typename Point, typename Traits>
+    void
+    append_chain(Iterator first, Iterator last, Chains<Point> &chains,
+                 const Traits &traits) {
+        auto left_turn = traits.left_turn_2_object();
+        std::vector<Point> &c = chains.points;
+        const std::size_t begin = c.size();
+        for (; first != last; ++first) {
+            while (c.size() >= begin + 2 &&
+                   !left_turn(c[c.size() - 2], c.back(), *first)) {
+                c.pop_back();
+            }
+            c.push_back(*first);
+        }
+        chains.start.push_back(c.size());
+    }
+
+    // One march along a hull chain, from `from` to `to`: the lower hull if
+    // before is Less_xy_2, the upper hull if it is the reverse order (with
+    // the upper chains of the groups, which run backwards). Writes every
+    // vertex except `to` and returns false if there are more than
+    // max_steps of them.
+    template <typename Point, typename Before, typename Traits,
+              typename OutputIterator>
+    bool
+    march(const Point &from, const Point &to, const Chains<Point> &chains,
+          Before before, std::size_t max_steps, OutputIterator &result,
+          const Traits &traits) {
+        auto left_turn = traits.left_turn_2_object();
+        auto equal = traits.equal_2_object();
+        const std::size_t n_groups = chains.start.size() - 1;
+
+        Point p = from;
+        for (std::size_t step = 0; !equal(p, to); ++step) {
+            if (step == max_steps) {
+                return false;
+            }
+            *result++ = p;
+
+            const Point *q = nullptr;
+            for (std::size_t g = 0; g < n_groups; ++g) {
+                auto first = chains.points.begin() + chains.start[g];
+                auto last = chains.points.begin() + chains.start[g + 1];
+                // The part of the chain after p, and on it the first point
+                // where the chain turns left as seen from p.
+                first = std::upper_bound(first, last, p, before);
+                if (first == last) {
+                    continue;
+                }
+                auto tangent = std::partition_point(
+                    first, last - 1, [&](const Point &c) {
+                        return !left_turn(p, c, *(&c + 1));
+                    });
+                // Keep the most clockwise candidate, and the farthest of
+                // collinear ones.
+                if (q == nullptr || left_turn(p, *tangent, *q) ||
+                    (!left_turn(p, *q, *tangent) && before(*q, *tangent))) {
+                    q = &*tangent;
+                }
+            }
+            p = *q;
+        }
+        return true;
+    }
+
+}
+
+template <typename InputIterator, typename OutputIterator, typename Traits>
+OutputIterator
+ch_chan(InputIterator first, InputIterator last, OutputIterator result,
+        const Traits &traits) {
+    using Point_2 = typename Traits::Point_2;
+    using namespace chan_internal;
+
+    std::vector<Point_2> points(first, last);
+    if (points.empty()) {
+        return result;
+    }
+    auto less_xy = traits.less_xy_2_object();
+    auto greater_xy = [&](const Point_2 &p, const Point_2 &q) {
+        return less_xy(q, p);
+    };
+    const auto [min, max] =
+        std::minmax_element(points.begin(), points.end(), less_xy);
+    const Point_2 lo = *min, hi = *max;
+    if (traits.equal_2_object()(lo, hi)) {
+        *result = lo;
+        return ++result;
+    }
+
+    std::vector<Point_2> hull;
+    for (std::size_t m = 16;; m = m < points.size() / m ? m * m
+                                                        : points.size()) {
+        // The group hulls. Sorting a group in place does not disturb the
+        // others, and the next round regroups them anyway.
+        Chains<Point_2> lower, upper;
+        lower.points.reserve(points.size());
+        upper.points.reserve(points.size());
+        for (std::size_t g = 0; g < points.size(); g += m) {
+            auto group_first = points.begin() + g;
+            auto group_last = points.begin() + std::min(points.size(), g + m);
+            std::sort(group_first, group_last, less_xy);
+            append_chain(group_first, group_last, lower, traits);
+            append_chain(std::make_reverse_iterator(group_last),
+                         std::make_reverse_iterator(group_first), upper,
+                         traits);
+        }
+
+        hull.clear();
+        auto out = std::back_inserter(hull);
+        if (march(lo, hi, lower, less_xy, m, out, traits) &&
+            march(hi, lo, upper, greater_xy, m - hull.size(), out, traits)) {
+            break;
+        }
+
+        // Every hull vertex is a vertex of the hull of its group, so the
+        // next round only needs the points of the group chains.
+        points.clear();
+        for (std::size_t g = 0; g + 1 < lower.start.size(); ++g) {
+            points.insert(points.end(),
+                          lower.points.begin() + lower.start[g],
+                          lower.points.begin() + lower.start[g + 1]);
+            if (upper.start[g + 1] - upper.start[g] > 2) {
+                points.insert(points.end(),
+                              upper.points.begin() + upper.start[g] + 1,
+                              upper.points.begin() + upper.start[g + 1] - 1);
+            }
+        }
+    }
+    return std::copy(hull.begin(), hull.end(), result);
+}
+
+// As CGAL::convex_hull_2(), the traits default to the kernel of the points.
+template <typename InputIterator, typename OutputIterator>
+OutputIterator
+ch_chan(InputIterator first, InputIterator last, OutputIterator result) {
+    using Point_2 = typename std::iterator_traits<InputIterator>::value_type;
+    using Kernel = typename CGAL::Kernel_traits<Point_2>::Kernel;
+    return ch_chan(first, last, result, Kernel());
+}
+
+#endif //CGAL_TUTORIAL_CHAN_HULL_H
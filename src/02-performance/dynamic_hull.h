@@ -0,0 +1,395 @@
+#ifndef CGAL_TUTORIAL_DYNAMIC_HULL_H
+#define CGAL_TUTORIAL_DYNAMIC_HULL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hull_chains.h"
+
+// A convex hull under insertions and deletions. IncrementalHull (see
+// incremental_hull.h) can only add points: once a point has been thrown away
+// as interior it cannot come back when a hull vertex is deleted. Here every
+// live point is kept.
+//
+// This is a practical, bucketed take on the Overmars-van Leeuwen structure.
+// The points are kept sorted with Less_xy_2 and cut into buckets of a few
+// hundred consecutive points, each a sorted std::vector with the hull of its
+// points cached as two monotone chains (see hull_chains.h). Consecutive
+// buckets are separated, so the hull of a run of buckets is obtained by
+// joining their chains at the bridges. The buckets are the leaves of a
+// balanced (AVL) tree in sorted order, every inner node keeps the joined
+// chains of its subtree, and the root holds the hull.
+//
+// An insertion or deletion finds its bucket by walking down the tree,
+// updates the sorted vector and its chains, and joins the chains again on
+// the way back up: O(B + h log(n / B)) for buckets of size B and hulls of h
+// points, rather than the O(n log n) of recomputing the hull, and usually
+// only O(B) since most changes do not reach the root (see apply()). When a
+// bucket grows to twice its nominal size it is split in two leaves, and
+// when it shrinks to a quarter its points are moved into a neighbour and
+// its leaf is removed. Either only changes the nodes on one or two paths to
+// the root, which are rebalanced by rotations, so it costs
+// O(B + h log(n / B)) as well, also when the updates keep hitting the same
+// bucket.
+//
+// Only Less_xy_2, Left_turn_2 and Equal_2 of the traits are used, so the
+// kernels of part-iv.cpp and part-v.cpp work as they are. The hull is the
+// same as that of CGAL::ch_graham_andrew() on the live points.
+
+template <typename Traits>
+class DynamicHull {
+public:
+
+    using Point_2 = typename Traits::Point_2;
+
+    // The nominal number of points per bucket.
+    static constexpr std::size_t bucket_size = 256;
+
+    explicit DynamicHull(const Traits &traits = Traits()): _traits{traits} {
+    }
+
+    // Starts with the points in [first, last).
+    template <typename InputIterator>
+    DynamicHull(InputIterator first, InputIterator last,
+                const Traits &traits = Traits())
+        : _traits{traits} {
+        std::vector<Point_2> points(first, last);
+        std::sort(points.begin(), points.end(), _traits.less_xy_2_object());
+        _size = points.size();
+        const std::size_t n_buckets =
+            (points.size() + bucket_size - 1) / bucket_size;
+        if (n_buckets > 0) {
+            _root = build(points, 0, n_buckets);
+        }
+    }
+
+    // Adds a point (which may already be present).
+    void
+    insert(const Point_2 &p) {
+        ++_size;
+        if (!_root) {
+            _root = leaf(std::vector<Point_2>(1, p));
+            return;
+        }
+        apply(_root, p, [&](std::unique_ptr<Node> &node) {
+            std::vector<Point_2> &bucket = node->points;
+            bucket.insert(std::upper_bound(bucket.begin(), bucket.end(), p,
+                                           _traits.less_xy_2_object()), p);
+            if (bucket.size() >= 2 * bucket_size) {
+                split(node);
+                return true;
+            }
+            return affects(node->chains, p) && refresh(*node);
+        });
+    }
+
+    // Removes one copy of p. Returns false if p is not a live point.
+    bool
+    erase(const Point_2 &p) {
+        if (!_root) {
+            return false;
+        }
+        bool found = false;
+        // The points of a bucket that became too small and was removed.
+        std::vector<Point_2> orphans;
+        apply(_root, p, [&](std::unique_ptr<Node> &node) {
+            std::vector<Point_2> &bucket = node->points;
+            auto it = std::lower_bound(bucket.begin(), bucket.end(), p,
+                                       _traits.less_xy_2_object());
+            if (it == bucket.end() || !_traits.equal_2_object()(*it, p)) {
+                return false;
+            }
+            found = true;
+            bucket.erase(it);
+            if (bucket.empty() ||
+                (bucket.size() <= bucket_size / 4 && node != _root)) {
+                orphans = std::move(bucket);
+                node.reset();
+                return true;
+            }
+            return affects(node->chains, p) && refresh(*node);
+        });
+        if (!found) {
+            return false;
+        }
+        --_size;
+        if (!orphans.empty()) {
+            absorb(std::move(orphans));
+        }
+        return true;
+    }
+
+    // The number of live points.
+    [[nodiscard]] std::size_t
+    size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool
+    empty() const {
+        return _size == 0;
+    }
+
+    // The two chains of the current hull (see hull_chains.h).
+    [[nodiscard]] const HullChains<Point_2> &
+    chains() const {
+        return _root ? _root->chains : _empty;
+    }
+
+    // Writes the hull counterclockwise from the smallest point.
+    template <typename OutputIterator>
+    OutputIterator
+    hull(OutputIterator result) const {
+        return write_hull(chains(), result, _traits);
+    }
+
+private:
+
+    // A node of the tree. A leaf holds a bucket and has no children; an
+    // inner node always has two. last is the rightmost leaf below the node,
+    // whose largest point we steer by.
+    struct Node {
+        std::vector<Point_2> points;
+        HullChains<Point_2> chains;
+        std::unique_ptr<Node> left, right;
+        const Node *last = this;
+        int height = 0;
+
+        [[nodiscard]] bool
+        is_leaf() const {
+            return !left;
+        }
+    };
+
+    [[nodiscard]] std::unique_ptr<Node>
+    leaf(std::vector<Point_2> points) const {
+        auto node = std::make_unique<Node>();
+        node->points = std::move(points);
+        refresh(*node);
+        return node;
+    }
+
+    [[nodiscard]] std::unique_ptr<Node>
+    inner(std::unique_ptr<Node> left, std::unique_ptr<Node> right) const {
+        auto node = std::make_unique<Node>();
+        node->left = std::move(left);
+        node->right = std::move(right);
+        pull(*node);
+        return node;
+    }
+
+    // A balanced tree over the buckets [first, last) of the sorted points.
+    [[nodiscard]] std::unique_ptr<Node>
+    build(const std::vector<Point_2> &points, std::size_t first,
+          std::size_t last) const {
+        if (last - first == 1) {
+            auto begin = points.begin() + first * bucket_size;
+            auto end = points.begin() +
+                       std::min(points.size(), last * bucket_size);
+            return leaf(std::vector<Point_2>(begin, end));
+        }
+        const std::size_t middle = first + (last - first) / 2;
+        return inner(build(points, first, middle),
+                     build(points, middle, last));
+    }
+
+    // Recomputes the chains of a leaf. Returns whether they changed.
+    bool
+    refresh(Node &node) const {
+        HullChains<Point_2> chains =
+            hull_chains(node.points.begin(), node.points.end(), _traits);
+        if (same(chains, node.chains)) {
+            return false;
+        }
+        node.chains = std::move(chains);
+        return true;
+    }
+
+    // Recomputes an inner node from its children.
+    void
+    pull(Node &node) const {
+        node.height = 1 + std::max(node.left->height, node.right->height);
+        node.last = node.right->last;
+        node.chains = join(node.left->chains, node.right->chains, _traits);
+    }
+
+    // What an update changed below a node: nothing, only the chains, or
+    // also the shape of the tree, after which every node above has to be
+    // recomputed, as its last leaf or its height may have changed.
+    enum class Changed { nothing, chains, tree };
+
+    // Walks down to the bucket of p, the first one whose largest point is
+    // not smaller than p or the last one, and calls change(leaf), which may
+    // update the leaf and return whether its chains changed, replace it by
+    // a subtree, or reset it to remove it. On the way back up we join the
+    // chains again, and rebalance after a change of shape. Most updates are
+    // to points inside the hull of their bucket, or inside that of a larger
+    // subtree, so when only chains changed we stop as soon as those of a
+    // node come out the same.
+    template <typename Change>
+    Changed
+    apply(std::unique_ptr<Node> &node, const Point_2 &p,
+          const Change &change) {
+        if (node->is_leaf()) {
+            const Node *before = node.get();
+            const bool changed = change(node);
+            if (node.get() != before) {
+                return Changed::tree;
+            }
+            return changed ? Changed::chains : Changed::nothing;
+        }
+        const bool go_right = _traits.less_xy_2_object()(
+            node->left->last->points.back(), p);
+        std::unique_ptr<Node> &child = go_right ? node->right : node->left;
+        const Changed changed = apply(child, p, change);
+        if (changed == Changed::nothing) {
+            return Changed::nothing;
+        }
+        if (!child) {
+            // The leaf was removed: its sibling takes the place of node.
+            node = std::move(go_right ? node->left : node->right);
+            return Changed::tree;
+        }
+        if (changed == Changed::tree) {
+            if (!rebalance(node)) {
+                pull(*node);
+            }
+            return Changed::tree;
+        }
+        HullChains<Point_2> chains =
+            join(node->left->chains, node->right->chains, _traits);
+        if (same(chains, node->chains)) {
+            return Changed::nothing;
+        }
+        node->chains = std::move(chains);
+        return Changed::chains;
+    }
+
+    // Restores the AVL balance of an inner node whose children are up to
+    // date. Returns false if it already was balanced; otherwise rotates,
+    // which recomputes the nodes that moved.
+    bool
+    rebalance(std::unique_ptr<Node> &node) const {
+        const int balance = node->left->height - node->right->height;
+        if (balance > 1) {
+            if (node->left->left->height < node->left->right->height) {
+                rotate_left(node->left);
+            }
+            rotate_right(node);
+            return true;
+        }
+        if (balance < -1) {
+            if (node->right->right->height < node->right->left->height) {
+                rotate_right(node->right);
+            }
+            rotate_left(node);
+            return true;
+        }
+        return false;
+    }
+
+    void
+    rotate_right(std::unique_ptr<Node> &node) const {
+        std::unique_ptr<Node> left = std::move(node->left);
+        node->left = std::move(left->right);
+        pull(*node);
+        left->right = std::move(node);
+        pull(*left);
+        node = std::move(left);
+    }
+
+    void
+    rotate_left(std::unique_ptr<Node> &node) const {
+        std::unique_ptr<Node> right = std::move(node->right);
+        node->right = std::move(right->left);
+        pull(*node);
+        right->left = std::move(node);
+        pull(*right);
+        node = std::move(right);
+    }
+
+    // Splits a full leaf into two.
+    void
+    split(std::unique_ptr<Node> &node) const {
+        std::vector<Point_2> &bucket = node->points;
+        auto middle = bucket.begin() + bucket.size() / 2;
+        std::vector<Point_2> right(middle, bucket.end());
+        bucket.erase(middle, bucket.end());
+        node = inner(leaf(std::move(bucket)), leaf(std::move(right)));
+    }
+
+    // Moves the points of a removed bucket into the neighbouring one they
+    // sort next to, the bucket after them or, if there is none, the one
+    // before, splitting that if it becomes full.
+    void
+    absorb(std::vector<Point_2> points) {
+        auto change = [&](std::unique_ptr<Node> &node) {
+            std::vector<Point_2> &bucket = node->points;
+            // With duplicates the bucket before may be the one found, so
+            // we check which end the points go to.
+            if (_traits.less_xy_2_object()(bucket.front(), points.back())) {
+                bucket.insert(bucket.end(), points.begin(), points.end());
+            } else {
+                bucket.insert(bucket.begin(), points.begin(), points.end());
+            }
+            if (bucket.size() >= 2 * bucket_size) {
+                split(node);
+                return true;
+            }
+            return refresh(*node);
+        };
+        if (!_root) {
+            _root = leaf(std::move(points));
+        } else {
+            apply(_root, points.front(), change);
+        }
+    }
+
+    // Whether inserting or erasing p can change the chains of a bucket:
+    // only if p is outside its hull or one of its vertices. Points inside
+    // the hull or on an edge are not vertices before or after. Both chains
+    // are sorted (the upper one backwards), so we find p in each by binary
+    // search.
+    [[nodiscard]] bool
+    affects(const HullChains<Point_2> &chains, const Point_2 &p) const {
+        auto less_xy = _traits.less_xy_2_object();
+        auto equal = _traits.equal_2_object();
+        auto left_turn = _traits.left_turn_2_object();
+        const std::vector<Point_2> &lower = chains.lower, &upper = chains.upper;
+        if (less_xy(p, lower.front()) || less_xy(lower.back(), p)) {
+            return true;
+        }
+        auto outside_or_vertex = [&](auto it) {
+            if (equal(*it, p)) {
+                return true;
+            }
+            return left_turn(*std::prev(it), p, *it);
+        };
+        auto l = std::lower_bound(lower.begin(), lower.end(), p, less_xy);
+        auto u = std::lower_bound(upper.begin(), upper.end(), p,
+                                  [&](const Point_2 &q, const Point_2 &r) {
+                                      return less_xy(r, q);
+                                  });
+        return outside_or_vertex(l) || outside_or_vertex(u);
+    }
+
+    [[nodiscard]] bool
+    same(const HullChains<Point_2> &a, const HullChains<Point_2> &b) const {
+        auto equal = _traits.equal_2_object();
+        auto same_chain = [&](const std::vector<Point_2> &p,
+                              const std::vector<Point_2> &q) {
+            return std::equal(p.begin(), p.end(), q.begin(), q.end(), equal);
+        };
+        return same_chain(a.lower, b.lower) && same_chain(a.upper, b.upper);
+    }
+
+    Traits _traits;
+    std::unique_ptr<Node> _root;
+    std::size_t _size = 0;
+    HullChains<Point_2> _empty;
+};
+
+#endif //CGAL_TUTORIAL_DYNAMIC_HULL_H
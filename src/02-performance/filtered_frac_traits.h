@@ -0,0 +1,187 @@
+#ifndef CGAL_TUTORIAL_FILTERED_FRAC_TRAITS_H
+#define CGAL_TUTORIAL_FILTERED_FRAC_TRAITS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
+#include "frac_traits.h"
+
+// FracTraits answers every predicate exactly with integer arithmetic. Most of
+// the time, though, a double approximation of the coordinates already settles
+// the question: if the approximate orientation determinant is far from zero
+// compared to the worst error the approximations can have made, its sign is
+// the sign of the exact determinant. This is the idea behind the filtered
+// predicates in CGAL's Exact_predicates_inexact_constructions_kernel, and the
+// class below layers the same kind of static-error filter over an exact traits
+// class: every predicate is first evaluated on doubles, and only when the
+// result is within the error bound do we fall back to the exact predicate.
+//
+// The error bounds. Frac::to_double() returns x~ with |x~ - x| <= 4u|x|, where
+// u = 2^-53 is the unit roundoff. Let M and N bound |x~| and |y~| over the
+// points of a predicate. Each difference x~1 - x~0 is then within 10uM of the
+// exact x1 - x0 (8uM from the inputs, 2uM from rounding the subtraction), each
+// product of differences within 44uMN of the exact product, and the final
+// determinant within 96uMN. We use 128uMN = 2^-46 MN, which also covers the
+// rounding in computing M and N. For comparisons of two x~ the error is at
+// most 4u(|x~p| + |x~q|), so a difference larger than 2^-49 max(|x~p|, |x~q|)
+// is certain. Fractions have long long components, so their doubles never get
+// anywhere near overflow or underflow.
+
+// Counts how often each filtered predicate was called, and how often the
+// filter could not decide and the exact predicate had to be used. These are
+// plain counters, so one statistics object should not be shared by several
+// threads.
+struct Filter_statistics {
+    std::size_t less_xy_calls = 0, less_xy_failures = 0;
+    std::size_t left_turn_calls = 0, left_turn_failures = 0;
+    std::size_t equal_calls = 0, equal_failures = 0;
+
+    [[nodiscard]] std::size_t
+    calls() const {
+        return less_xy_calls + left_turn_calls + equal_calls;
+    }
+
+    [[nodiscard]] std::size_t
+    failures() const {
+        return less_xy_failures + left_turn_failures + equal_failures;
+    }
+
+    // The fraction of predicate calls that needed exact arithmetic.
+    [[nodiscard]] double
+    failure_rate() const {
+        return calls() == 0 ? 0.0 : static_cast<double>(failures()) / calls();
+    }
+};
+
+template <typename ExactTraits = FracTraits>
+class FilteredFracTraits {
+public:
+
+    using Point_2 = typename ExactTraits::Point_2;
+
+    // Sign of x~p - x~q if it is certain, 0 otherwise.
+    static int
+    certain_sign_of_difference(double p, double q) {
+        double bound = 0x1p-49 * std::max(std::abs(p), std::abs(q));
+        double d = p - q;
+        return d > bound ? 1 : (d < -bound ? -1 : 0);
+    }
+
+    class Less_xy_2 {
+    public:
+        explicit
+        Less_xy_2(Filter_statistics *stats): _stats{stats} {
+        }
+
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            ++_stats->less_xy_calls;
+            int sx = certain_sign_of_difference(p.x().to_double(),
+                                                q.x().to_double());
+            if (sx != 0) {
+                return sx < 0;
+            }
+            // The filter never certifies that two x's are equal, so if it
+            // cannot order them the y's cannot help either.
+            ++_stats->less_xy_failures;
+            return typename ExactTraits::Less_xy_2()(p, q);
+        }
+
+    private:
+        Filter_statistics *_stats;
+    };
+
+    class Left_turn_2 {
+    public:
+        explicit
+        Left_turn_2(Filter_statistics *stats): _stats{stats} {
+        }
+
+        bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            ++_stats->left_turn_calls;
+            double x0 = p0.x().to_double(), y0 = p0.y().to_double();
+            double x1 = p1.x().to_double(), y1 = p1.y().to_double();
+            double x2 = p2.x().to_double(), y2 = p2.y().to_double();
+
+            double m = std::max({std::abs(x0), std::abs(x1), std::abs(x2)});
+            double n = std::max({std::abs(y0), std::abs(y1), std::abs(y2)});
+            double bound = 0x1p-46 * m * n;
+
+            double det = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+            if (det > bound) {
+                return true;
+            }
+            if (det < -bound) {
+                return false;
+            }
+            ++_stats->left_turn_failures;
+            return typename ExactTraits::Left_turn_2()(p0, p1, p2);
+        }
+
+    private:
+        Filter_statistics *_stats;
+    };
+
+    class Equal_2 {
+    public:
+        explicit
+        Equal_2(Filter_statistics *stats): _stats{stats} {
+        }
+
+        // The filter can only prove that two points differ.
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            ++_stats->equal_calls;
+            if (certain_sign_of_difference(p.x().to_double(),
+                                           q.x().to_double()) != 0 ||
+                certain_sign_of_difference(p.y().to_double(),
+                                           q.y().to_double()) != 0) {
+                return false;
+            }
+            ++_stats->equal_failures;
+            return typename ExactTraits::Equal_2()(p, q);
+        }
+
+    private:
+        Filter_statistics *_stats;
+    };
+
+    // CGAL copies traits objects around freely, so the statistics live in a
+    // shared object that every copy (and every functor) points to.
+    FilteredFracTraits(): _stats{std::make_shared<Filter_statistics>()} {
+    }
+
+    [[nodiscard]] Less_xy_2
+    less_xy_2_object() const {
+        return Less_xy_2(_stats.get());
+    }
+
+    [[nodiscard]] Left_turn_2
+    left_turn_2_object() const {
+        return Left_turn_2(_stats.get());
+    }
+
+    [[nodiscard]] Equal_2
+    equal_2_object() const {
+        return Equal_2(_stats.get());
+    }
+
+    [[nodiscard]] const Filter_statistics &
+    statistics() const {
+        return *_stats;
+    }
+
+    void
+    reset_statistics() {
+        *_stats = Filter_statistics();
+    }
+
+private:
+    std::shared_ptr<Filter_statistics> _stats;
+};
+
+#endif //CGAL_TUTORIAL_FILTERED_FRAC_TRAITS_H
@@ -0,0 +1,174 @@
+#ifndef CGAL_TUTORIAL_FIXED_HULL_H
+#define CGAL_TUTORIAL_FIXED_HULL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include <CGAL/Kernel_traits.h>
+
+// part-iv.cpp computes the hull of a Point_2 points[5]. For so few points
+// CGAL::convex_hull_2() spends most of its time on things that do not depend
+// on the points: copying them into a std::vector, dispatching std::sort() on
+// the size, and looping over sizes it does not know. convex_hull_2_fixed()
+// takes the size as a template parameter instead, for arrays of up to about
+// 16 points, and is called the same way:
+//
+//    Point_2 points[5] = {...};
+//    Point_2 result[5];
+//    Point_2 *result_past_end = convex_hull_2_fixed(points, result);
+//
+// The points are copied into a std::array on the stack and sorted with
+// Batcher's odd-even merge sorting network for N, which is computed at
+// compile time and unrolled: a fixed sequence of compare-exchanges, each a
+// Less_xy_2 followed by two selects, with no branches. The two scans of
+// CGAL::ch_graham_andrew() then run over the sorted array; their loops have
+// a fixed trip count that the compiler unrolls, and only the popping of the
+// stack depends on the points. The result is the same as that of
+// CGAL::ch_graham_andrew(), and only Less_xy_2, Left_turn_2 and Equal_2 of
+// the traits are used.
+
+namespace fixed_hull_internal {
+
+    // Batcher's odd-even merge sort for n elements, as pairs (i, j) with
+    // i < j to be compare-exchanged in order. It is passed an array with
+    // room for all of them and returns their number.
+    template <typename Pairs>
+    constexpr std::size_t
+    odd_even_merge_network(std::size_t n, Pairs *pairs) {
+        std::size_t size = 0;
+        for (std::size_t p = 1; p < n; p *= 2) {
+            for (std::size_t k = p; k >= 1; k /= 2) {
+                for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+                    for (std::size_t i = 0; i < std::min(k, n - j - k); ++i) {
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                            if (pairs) {
+                                pairs[size] = {i + j, i + j + k};
+                            }
+                            ++size;
+                        }
+                    }
+                }
+            }
+        }
+        return size;
+    }
+
+    template <std::size_t N>
+    constexpr auto
+    make_sorting_network() {
+        using Pair = std::pair<std::size_t, std::size_t>;
+        constexpr std::size_t size =
+            odd_even_merge_network<Pair>(N, nullptr);
+        std::array<Pair, size> network{};
+        odd_even_merge_network(N, network.data());
+        return network;
+    }
+
+    template <std::size_t N>
+    inline constexpr auto sorting_network = make_sorting_network<N>();
+
+    // Sorts points with the network for N, unrolled.
+    template <typename Point, std::size_t N, typename Less, std::size_t... I>
+    void
+    sort(std::array<Point, N> &points, Less less,
+         std::index_sequence<I...>) {
+        constexpr auto &network = sorting_network<N>;
+        auto compare_exchange = [&](Point &a, Point &b) {
+            const bool swap = less(b, a);
+            const Point low = swap ? b : a;
+            const Point high = swap ? a : b;
+            a = low;
+            b = high;
+        };
+        (compare_exchange(points[network[I].first],
+                          points[network[I].second]), ...);
+    }
+
+    // One scan of CGAL::ch_graham_andrew() over the sorted points, from
+    // points[first] towards points[last] in steps of Step (1 or -1): writes
+    // the chain from points[first] up to, but without, points[last].
+    template <int Step, typename Point, std::size_t N, typename OutputIterator,
+              typename Traits>
+    OutputIterator
+    scan(const std::array<Point, N> &points, OutputIterator result,
+         const Traits &traits) {
+        constexpr std::size_t first = Step > 0 ? 0 : N - 1;
+        constexpr std::size_t last = Step > 0 ? N - 1 : 0;
+        auto left_turn = traits.left_turn_2_object();
+        const Point &west = points[first], &east = points[last];
+
+        std::array<Point, N + 1> stack;
+        std::size_t size = 0;
+        stack[size++] = east;
+        stack[size++] = west;
+        for (std::size_t k = 1; k + 1 < N; ++k) {
+            const Point &p = points[Step > 0 ? k : N - 1 - k];
+            // Only points strictly right of the line from the top of the
+            // stack to the last point can be on the chain.
+            if (left_turn(stack[size - 1], p, east)) {
+                while (size > 2 &&
+                       !left_turn(stack[size - 2], stack[size - 1], p)) {
+                    --size;
+                }
+                stack[size++] = p;
+            }
+        }
+        for (std::size_t k = 1; k < size; ++k) {
+            *result++ = stack[k];
+        }
+        return result;
+    }
+
+}
+
+template <typename Point, std::size_t N, typename OutputIterator,
+          typename Traits>
+OutputIterator
+convex_hull_2_fixed(const std::array<Point, N> &points, OutputIterator result,
+                    const Traits &traits) {
+    using namespace fixed_hull_internal;
+    if constexpr (N <= 1) {
+        return std::copy(points.begin(), points.end(), result);
+    } else {
+        std::array<Point, N> sorted = points;
+        sort(sorted, traits.less_xy_2_object(), std::make_index_sequence<
+            sorting_network<N>.size()>());
+        if (traits.equal_2_object()(sorted[0], sorted[N - 1])) {
+            *result++ = sorted[0];
+            return result;
+        }
+        result = scan<1>(sorted, result, traits);
+        return scan<-1>(sorted, result, traits);
+    }
+}
+
+// The same for a C array, as the Point_2 points[5] of part-iv.cpp.
+template <typename Point, std::size_t N, typename OutputIterator,
+          typename Traits>
+OutputIterator
+convex_hull_2_fixed(const Point (&points)[N], OutputIterator result,
+                    const Traits &traits) {
+    std::array<Point, N> copy;
+    std::copy(points, points + N, copy.begin());
+    return convex_hull_2_fixed(copy, result, traits);
+}
+
+// As CGAL::convex_hull_2(), the traits default to the kernel of the points.
+template <typename Point, std::size_t N, typename OutputIterator>
+OutputIterator
+convex_hull_2_fixed(const std::array<Point, N> &points,
+                    OutputIterator result) {
+    using Kernel = typename CGAL::Kernel_traits<Point>::Kernel;
+    return convex_hull_2_fixed(points, result, Kernel());
+}
+
+template <typename Point, std::size_t N, typename OutputIterator>
+OutputIterator
+convex_hull_2_fixed(const Point (&points)[N], OutputIterator result) {
+    using Kernel = typename CGAL::Kernel_traits<Point>::Kernel;
+    return convex_hull_2_fixed(points, result, Kernel());
+}
+
+#endif //CGAL_TUTORIAL_FIXED_HULL_H
@@ -0,0 +1,565 @@
+#ifndef CGAL_TUTORIAL_FRAC_H
+#define CGAL_TUTORIAL_FRAC_H
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <istream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// In part-vii.cpp we wrote a toy fraction type, Frac, which was good enough to
+// show how a Traits class is put together. It has two problems that stop us
+// from using it on real data:
+//    1) every comparison cross-multiplies two long long values, and as soon as
+//       the components grow past roughly 3e9 the products silently overflow;
+//    2) every +, -, * and / calls std::gcd, so a single orientation test runs
+//       the gcd several times.
+// The Frac in this file fixes both. Every intermediate product is formed with
+// 128-bit integers - the product of two long longs always fits in one - so
+// comparisons are exact for every fraction we can store. The result of an
+// arithmetic operation is only reduced when it would not otherwise fit back
+// into two long longs (or when we ask for it with normalize()), and if even the
+// reduced value does not fit we throw std::overflow_error instead of quietly
+// returning garbage.
+//
+// Denominators are always positive: the constructors and the arithmetic
+// operators make sure of it. This is what makes the predicates cheap - the
+// sign of a fraction is the sign of its numerator, and cross-multiplying by
+// a denominator never flips an inequality - and when both denominators are
+// 1, as they are for integer coordinates, comparing two fractions is a
+// single comparison of the numerators. A fraction constructed from a
+// numerator and a denominator is also reduced to lowest terms; the results of
+// arithmetic are only reduced when needed (see above), so equal fractions can
+// still have different components.
+//
+// Apart from to_interval() and the stream operators, everything in Frac is
+// constexpr, so fractions - and the hulls built from them, see
+// static_hull.h - can be computed at compile time.
+
+using ll = long long;
+using i128 = __int128;
+
+namespace frac_internal {
+
+    // The components of a Frac are kept in the symmetric range
+    // [-ll_max, ll_max], i.e. we never store LLONG_MIN. This means negation
+    // never overflows, and the sum of two products of components always fits
+    // in an i128.
+    constexpr ll ll_max = std::numeric_limits<ll>::max();
+
+    // Tests whether a 128-bit value can be stored as a Frac component.
+    constexpr bool
+    fits(i128 v) {
+        return v >= -static_cast<i128>(ll_max) && v <= static_cast<i128>(ll_max);
+    }
+
+    // The greatest common divisor of two 128-bit values (std::gcd is not
+    // guaranteed to accept __int128 in strict standard mode).
+    constexpr i128
+    gcd(i128 a, i128 b) {
+        unsigned __int128 x = a < 0 ? -static_cast<unsigned __int128>(a) : a;
+        unsigned __int128 y = b < 0 ? -static_cast<unsigned __int128>(b) : b;
+        while (y != 0) {
+            unsigned __int128 t = x % y;
+            x = y;
+            y = t;
+        }
+        return static_cast<i128>(x);
+    }
+
+}
+
+class Frac {
+public:
+
+    // A default constructed fraction is zero, i.e. 0/1.
+    constexpr Frac(): _num{0}, _den{1} {
+    }
+
+    // A fraction constructed from an integer has a denominator of 1. The
+    // conversion is implicit, as for CGAL's own number types, so that
+    // expressions like 'x / 2' or 'x < 0' work.
+    template <std::integral T>
+    constexpr Frac(T num): _num{static_cast<ll>(num)}, _den{1} {
+        if constexpr (std::is_unsigned_v<T>) {
+            if (num > static_cast<unsigned long long>(frac_internal::ll_max)) {
+                throw std::overflow_error("Frac: component out of range");
+            }
+        } else {
+            check_component(_num);
+        }
+    }
+
+    // A fraction constructed from a double holds the exact value of that
+    // double: every finite double is m * 2^e for a 53-bit integer m, so it is
+    // a fraction with a power of two as denominator. This is why the point
+    // (0, 0.3) built from doubles is not the same as the one read from the
+    // text "0 3/10" (see part-iii.cpp). We throw if the exact value does not
+    // fit in two long longs. We take m and e straight from the bits of the
+    // double (std::frexp is not constexpr), so that this constructor can be
+    // used in constant expressions too.
+    constexpr Frac(double d): _num{0}, _den{1} {
+        const auto bits = std::bit_cast<unsigned long long>(d);
+        const int biased_exp = static_cast<int>(bits >> 52 & 0x7ff);
+        if (biased_exp == 0x7ff) {
+            throw std::domain_error("Frac: double is not finite");
+        }
+        auto mant = static_cast<ll>(bits & ((1ULL << 52) - 1));
+        if (biased_exp != 0) {
+            mant |= static_cast<ll>(1) << 52;
+        }
+        if (mant == 0) {
+            return;
+        }
+        // Subnormals have the same exponent as the smallest normal doubles.
+        int exp = (biased_exp != 0 ? biased_exp : 1) - 1075;
+        int tz = std::countr_zero(static_cast<unsigned long long>(mant));
+        mant >>= tz;
+        exp += tz;
+        if (bits >> 63) {
+            mant = -mant;
+        }
+        if (exp >= 0) {
+            auto width = std::bit_width(
+                static_cast<unsigned long long>(mant < 0 ? -mant : mant));
+            if (width + exp > 63) {
+                throw std::overflow_error("Frac: double out of range");
+            }
+            _num = mant * (static_cast<ll>(1) << exp);
+        } else {
+            if (-exp > 62) {
+                throw std::overflow_error("Frac: double out of range");
+            }
+            _num = mant;
+            _den = static_cast<ll>(1) << -exp;
+        }
+    }
+
+    // A fraction constructed from a numerator and denominator is reduced to
+    // lowest terms with a positive denominator. Unlike the toy version we
+    // refuse a zero denominator.
+    constexpr Frac(ll num, ll den): _num{num}, _den{den} {
+        check_component(num);
+        check_component(den);
+        if (den == 0) {
+            throw std::domain_error("Frac: zero denominator");
+        }
+        if (den < 0) {
+            _num = -num;
+            _den = -den;
+        }
+        if (_den != 1) {
+            ll g = std::gcd(_num, _den);
+            _num /= g;
+            _den /= g;
+        }
+    }
+
+    // Three-way comparison with another fraction; returns -1, 0 or +1. For
+    // two integers we only compare the numerators; otherwise we
+    // cross-multiply, in 128 bits so that it is always exact. (We do not
+    // test for equal denominators in general: after reduction, equal
+    // denominators other than 1 come and go at random along a sequence of
+    // points, and the mispredicted branch costs more than the two
+    // multiplications it saves.)
+    [[nodiscard]] constexpr int
+    compare(const Frac &other) const {
+        if ((_den | other._den) == 1) {
+            return (_num > other._num) - (_num < other._num);
+        }
+        i128 lhs = static_cast<i128>(_num) * other._den;
+        i128 rhs = static_cast<i128>(other._num) * _den;
+        return (lhs > rhs) - (lhs < rhs);
+    }
+
+    // The comparison and arithmetic operators are friends rather than members
+    // so that an int or double on either side is converted to a Frac.
+    friend constexpr bool
+    operator <(const Frac &a, const Frac &b) {
+        return a.compare(b) < 0;
+    }
+
+    friend constexpr bool
+    operator <=(const Frac &a, const Frac &b) {
+        return a.compare(b) <= 0;
+    }
+
+    friend constexpr bool
+    operator >(const Frac &a, const Frac &b) {
+        return a.compare(b) > 0;
+    }
+
+    friend constexpr bool
+    operator >=(const Frac &a, const Frac &b) {
+        return a.compare(b) >= 0;
+    }
+
+    friend constexpr bool
+    operator ==(const Frac &a, const Frac &b) {
+        if ((a._den | b._den) == 1) {
+            return a._num == b._num;
+        }
+        return static_cast<i128>(a._num) * b._den ==
+               static_cast<i128>(b._num) * a._den;
+    }
+
+    // The arithmetic operators compute the new numerator and denominator in
+    // 128 bits and hand them to from_wide(), which only pays for a gcd when
+    // the result would not fit otherwise.
+    [[nodiscard]] friend constexpr Frac
+    operator +(const Frac &a, const Frac &b) {
+        return from_wide(
+            static_cast<i128>(a._num) * b._den +
+            static_cast<i128>(b._num) * a._den,
+            static_cast<i128>(a._den) * b._den
+        );
+    }
+
+    [[nodiscard]] friend constexpr Frac
+    operator -(const Frac &a, const Frac &b) {
+        return from_wide(
+            static_cast<i128>(a._num) * b._den -
+            static_cast<i128>(b._num) * a._den,
+            static_cast<i128>(a._den) * b._den
+        );
+    }
+
+    [[nodiscard]] friend constexpr Frac
+    operator *(const Frac &a, const Frac &b) {
+        return from_wide(
+            static_cast<i128>(a._num) * b._num,
+            static_cast<i128>(a._den) * b._den
+        );
+    }
+
+    [[nodiscard]] friend constexpr Frac
+    operator /(const Frac &a, const Frac &b) {
+        return from_wide(
+            static_cast<i128>(a._num) * b._den,
+            static_cast<i128>(a._den) * b._num
+        );
+    }
+
+    // Negation cannot overflow, since LLONG_MIN is never stored.
+    [[nodiscard]] constexpr Frac
+    operator -() const {
+        return make(-_num, _den);
+    }
+
+    constexpr Frac &
+    operator +=(const Frac &other) {
+        return *this = *this + other;
+    }
+
+    constexpr Frac &
+    operator -=(const Frac &other) {
+        return *this = *this - other;
+    }
+
+    constexpr Frac &
+    operator *=(const Frac &other) {
+        return *this = *this * other;
+    }
+
+    constexpr Frac &
+    operator /=(const Frac &other) {
+        return *this = *this / other;
+    }
+
+    // Reduces the fraction to lowest terms.
+    constexpr Frac &
+    normalize() {
+        *this = from_wide_reduced(_num, _den);
+        return *this;
+    }
+
+    // Returns a copy of the fraction in lowest terms.
+    [[nodiscard]] constexpr Frac
+    normalized() const {
+        return from_wide_reduced(_num, _den);
+    }
+
+    // Returns -1, 0 or +1. The denominator is positive, so this is the sign
+    // of the numerator.
+    [[nodiscard]] constexpr int
+    sign() const {
+        return (_num > 0) - (_num < 0);
+    }
+
+    [[nodiscard]] constexpr bool
+    positive() const {
+        return _num > 0;
+    }
+
+    // The nearest double to num() / den(), up to three rounding errors (one
+    // for each component and one for the division), so the relative error is
+    // below 4 * 2^-53.
+    [[nodiscard]] constexpr double
+    to_double() const {
+        return static_cast<double>(_num) / static_cast<double>(_den);
+    }
+
+    // An interval [lo, hi] of doubles that is guaranteed to contain the exact
+    // value, as needed by CGAL's filtered kernels. If both components are
+    // exactly representable as doubles, to_double() is the correctly rounded
+    // quotient and one step to each side is enough (and if the denominator
+    // is a power of two it is exact); otherwise it is within four units in
+    // the last place.
+    [[nodiscard]] std::pair<double, double>
+    to_interval() const {
+        const double q = to_double();
+        const auto an = static_cast<unsigned long long>(_num < 0 ? -_num : _num);
+        const auto ad = static_cast<unsigned long long>(_den);
+        const unsigned long long exact_limit = 1ULL << 53;
+        int steps = 4;
+        if (an <= exact_limit && ad <= exact_limit) {
+            if (std::has_single_bit(ad)) {
+                return {q, q};
+            }
+            steps = 1;
+        }
+        double lo = q, hi = q;
+        for (int i = 0; i < steps; ++i) {
+            lo = std::nextafter(lo, -std::numeric_limits<double>::infinity());
+            hi = std::nextafter(hi, std::numeric_limits<double>::infinity());
+        }
+        return {lo, hi};
+    }
+
+    [[nodiscard]] constexpr ll
+    num() const { return _num; }
+
+    [[nodiscard]] constexpr ll
+    den() const { return _den; }
+
+private:
+    ll _num;
+    ll _den;
+
+    static constexpr void
+    check_component(ll v) {
+        if (v < -frac_internal::ll_max) {
+            throw std::overflow_error("Frac: component out of range");
+        }
+    }
+
+    // Builds a fraction from a 128-bit numerator and denominator, making the
+    // denominator positive (only division can make it negative).
+    static constexpr Frac
+    from_wide(i128 num, i128 den) {
+        if (den == 0) {
+            throw std::domain_error("Frac: division by zero");
+        }
+        if (den < 0) {
+            num = -num;
+            den = -den;
+        }
+        if (frac_internal::fits(num) && frac_internal::fits(den)) {
+            return make(static_cast<ll>(num), static_cast<ll>(den));
+        }
+        return from_wide_reduced(num, den);
+    }
+
+    // As from_wide() for a positive denominator, but always reduces to
+    // lowest terms. Throws if the reduced fraction still does not fit in two
+    // long longs.
+    static constexpr Frac
+    from_wide_reduced(i128 num, i128 den) {
+        i128 g = frac_internal::gcd(num, den);
+        num /= g;
+        den /= g;
+        if (!frac_internal::fits(num) || !frac_internal::fits(den)) {
+            throw std::overflow_error("Frac: result does not fit in long long");
+        }
+        return make(static_cast<ll>(num), static_cast<ll>(den));
+    }
+
+    // Builds a fraction without any checks.
+    static constexpr Frac
+    make(ll num, ll den) {
+        Frac f;
+        f._num = num;
+        f._den = den;
+        return f;
+    }
+};
+
+// Prints a fraction as 'num/den'.
+inline std::ostream &
+operator <<(std::ostream &out, const Frac &f) {
+    out << f.num() << "/" << f.den();
+    return out;
+}
+
+namespace frac_internal {
+
+    // Reads a run of decimal digits at p with std::from_chars() and moves p
+    // past it. An empty run gives 0 and leaves p where it was. Returns false
+    // if the digits do not fit in an unsigned long long.
+    inline bool
+    read_digits(const char *&p, const char *last, unsigned long long &value) {
+        value = 0;
+        auto [ptr, ec] = std::from_chars(p, last, value);
+        if (ec == std::errc::invalid_argument) {
+            return true;
+        }
+        p = ptr;
+        return ec == std::errc();
+    }
+
+    constexpr bool
+    is_digit(const char *p, const char *last) {
+        return p != last && *p >= '0' && *p <= '9';
+    }
+
+    constexpr i128
+    power_of_ten(int e) {
+        i128 r = 1;
+        while (e-- > 0) {
+            r *= 10;
+        }
+        return r;
+    }
+
+}
+
+// Parses a fraction at the start of [first, last), in the manner of
+// std::from_chars(): no leading whitespace is skipped, the longest prefix
+// that forms a number is used, and the returned ptr points just past it. We
+// accept
+//    * integers: "3", "-17", "+4";
+//    * quotients: "1/3", "-2/6", "1/-3";
+//    * decimals, optionally with an exponent: "0.3", ".5", "4.", "-2.5e-3".
+// Decimals are converted exactly, so "0.3" gives 3/10 rather than the double
+// nearest to 0.3. The limit is that the digits, read without the decimal
+// point, have to fit in a long long, as do the numerator and denominator of
+// the result after reduction: "922337203685477580.7" gives
+// 9223372036854775807/10. At most 18 digits may follow the point, and the
+// exponent may be at most 18. If there is no number at the start, or the
+// quotient has a zero denominator, the result is std::errc::invalid_argument
+// with ptr == first. If the number does not fit in a Frac, it is
+// std::errc::result_out_of_range with ptr past the number. In both cases value
+// is left unchanged. Nothing is allocated, so this is the function to use for
+// reading large amounts of text; operator>> below is built on it.
+inline std::from_chars_result
+from_chars(const char *first, const char *last, Frac &value) {
+    using frac_internal::is_digit;
+    using frac_internal::read_digits;
+    using frac_internal::fits;
+
+    const char *p = first;
+    bool negative = false;
+    if (p != last && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    const char *digits_start = p;
+    unsigned long long int_part;
+    bool in_range = read_digits(p, last, int_part);
+    const bool has_int = p != digits_start;
+
+    // A quotient: the numerator has to be an integer, and the denominator
+    // (which may carry a minus sign) has to follow the '/' directly.
+    if (has_int && p != last && *p == '/') {
+        const char *q = p + 1;
+        bool den_negative = q != last && *q == '-';
+        q += den_negative;
+        if (is_digit(q, last)) {
+            unsigned long long den;
+            in_range &= read_digits(q, last, den);
+            if (den == 0 && in_range) {
+                return {first, std::errc::invalid_argument};
+            }
+            if (!in_range || int_part > static_cast<unsigned long long>(
+                                            frac_internal::ll_max) ||
+                den > static_cast<unsigned long long>(frac_internal::ll_max)) {
+                return {q, std::errc::result_out_of_range};
+            }
+            auto num = static_cast<ll>(int_part);
+            value = Frac(negative != den_negative ? -num : num,
+                         static_cast<ll>(den));
+            return {q, std::errc()};
+        }
+    }
+
+    // A decimal. The digits after the point extend the integer part, and
+    // each of them adds a factor 10 to the denominator.
+    i128 num = int_part;
+    int n_frac = 0;
+    if (p != last && *p == '.' && (has_int || is_digit(p + 1, last))) {
+        ++p;
+        const char *frac_start = p;
+        unsigned long long frac_part;
+        in_range &= read_digits(p, last, frac_part);
+        n_frac = static_cast<int>(p - frac_start);
+        if (n_frac > 18) {
+            in_range = false;
+        } else {
+            num = num * frac_internal::power_of_ten(n_frac) + frac_part;
+        }
+    } else if (!has_int) {
+        return {first, std::errc::invalid_argument};
+    }
+    in_range &= fits(num);
+
+    // An exponent is only part of the number if digits follow.
+    int exp = 0;
+    if (p != last && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool exp_negative = false;
+        if (q != last && (*q == '+' || *q == '-')) {
+            exp_negative = *q == '-';
+            ++q;
+        }
+        if (is_digit(q, last)) {
+            unsigned long long e;
+            in_range &= read_digits(q, last, e) && e <= 18;
+            exp = exp_negative ? -static_cast<int>(e) : static_cast<int>(e);
+            p = q;
+        }
+    }
+    if (!in_range) {
+        return {p, std::errc::result_out_of_range};
+    }
+
+    // num < 2^63 and both powers of ten are at most 10^36, so these fit.
+    i128 den = frac_internal::power_of_ten(n_frac - std::min(exp, 0));
+    num *= frac_internal::power_of_ten(std::max(exp, 0));
+    if (!fits(num) || !fits(den)) {
+        i128 g = frac_internal::gcd(num, den);
+        num /= g;
+        den /= g;
+        if (!fits(num) || !fits(den)) {
+            return {p, std::errc::result_out_of_range};
+        }
+    }
+    value = Frac(static_cast<ll>(negative ? -num : num), static_cast<ll>(den));
+    return {p, std::errc()};
+}
+
+// Reads a fraction in any of the forms accepted by from_chars() above. The
+// whole whitespace-delimited token has to be a number; otherwise, or if the
+// value does not fit, the stream's failbit is set.
+inline std::istream &
+operator >>(std::istream &in, Frac &f) {
+    std::string s;
+    if (!(in >> s)) {
+        return in;
+    }
+    auto [ptr, ec] = from_chars(s.data(), s.data() + s.size(), f);
+    if (ec != std::errc() || ptr != s.data() + s.size()) {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+#endif //CGAL_TUTORIAL_FRAC_H
@@ -0,0 +1,110 @@
+#ifndef CGAL_TUTORIAL_FRAC_CGAL_H
+#define CGAL_TUTORIAL_FRAC_CGAL_H
+
+// So far Frac could only be used through our hand-written FracTraits. CGAL's
+// kernels, however, are parameterized by a number type: Simple_cartesian<FT>
+// works for any FT that is a model of the FieldNumberType concept [1]. To make
+// Frac such a model we have to tell CGAL about it, which is done by
+// specializing two traits classes:
+//    * Algebraic_structure_traits [2] - what kind of algebraic structure Frac
+//      is (a field, since we can divide) and whether it is exact (it is);
+//    * Real_embeddable_traits [3] - how Frac sits on the real line: its sign,
+//      and how to convert it to a double or to an interval of doubles.
+// With these in place, Simple_cartesian<Frac> is an exact kernel, and
+// Filtered_kernel<Simple_cartesian<Frac>> evaluates its predicates on
+// intervals first and only uses Frac arithmetic when the intervals cannot
+// decide - the same scheme that Exact_predicates_exact_constructions_kernel
+// uses, but without a lazy DAG and without GMP.
+//
+// The catch is that Frac has fixed-size components: constructions that need
+// more than 63 bits throw std::overflow_error rather than silently failing.
+
+#include <utility>
+
+#include <CGAL/number_type_basic.h>
+#include <CGAL/Coercion_traits.h>
+#include <CGAL/Filtered_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+
+#include "frac.h"
+
+namespace CGAL {
+
+template <>
+class Algebraic_structure_traits<Frac>
+    : public Algebraic_structure_traits_base<Frac, Field_tag> {
+public:
+    typedef Tag_true Is_exact;
+    typedef Tag_false Is_numerical_sensitive;
+};
+
+template <>
+class Real_embeddable_traits<Frac>
+    : public INTERN_RET::Real_embeddable_traits_base<Frac, CGAL::Tag_true> {
+public:
+
+    class Sgn : public CGAL::cpp98::unary_function<Type, ::CGAL::Sign> {
+    public:
+        ::CGAL::Sign
+        operator()(const Type &x) const {
+            return static_cast<::CGAL::Sign>(x.sign());
+        }
+    };
+
+    class To_double : public CGAL::cpp98::unary_function<Type, double> {
+    public:
+        double
+        operator()(const Type &x) const {
+            return x.to_double();
+        }
+    };
+
+    class To_interval
+        : public CGAL::cpp98::unary_function<Type, std::pair<double, double>> {
+    public:
+        std::pair<double, double>
+        operator()(const Type &x) const {
+            return x.to_interval();
+        }
+    };
+};
+
+// Mixed arithmetic with the built-in types goes through Frac's implicit
+// constructors.
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(short, Frac)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(int, Frac)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(long, Frac)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(long long, Frac)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(double, Frac)
+
+// Filtered_kernel needs an exact kernel to fall back on, and picks its number
+// type with these selectors. Frac is already exact, so it is its own exact
+// type (otherwise the filtered kernel would convert to GMP rationals).
+namespace internal {
+
+template <>
+struct Exact_field_selector<Frac> {
+    typedef Frac Type;
+};
+
+template <>
+struct Exact_ring_selector<Frac> {
+    typedef Frac Type;
+};
+
+}
+
+}
+
+// An exact kernel over Frac, and the same kernel with interval filtering on
+// its predicates. The static filters of Filtered_kernel are only useful for
+// double coordinates, so we switch them off.
+typedef CGAL::Simple_cartesian<Frac> FracKernel;
+typedef CGAL::Filtered_kernel<FracKernel, false> FilteredFracKernel;
+
+// References
+// 1. https://doc.cgal.org/latest/Algebraic_foundations/classFieldNumberType.html
+// 2. https://doc.cgal.org/latest/Algebraic_foundations/classAlgebraicStructureTraits.html
+// 3. https://doc.cgal.org/latest/Algebraic_foundations/classRealEmbeddableTraits.html
+
+#endif //CGAL_TUTORIAL_FRAC_CGAL_H
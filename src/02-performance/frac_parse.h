@@ -0,0 +1,139 @@
+#ifndef CGAL_TUTORIAL_FRAC_PARSE_H
+#define CGAL_TUTORIAL_FRAC_PARSE_H
+
+#include <bit>
+#include <charconv>
+#include <system_error>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+
+#include "frac_point_2.h"
+
+// In part-iii.cpp we read exact points with a std::istringstream per point,
+// which is fine for three points but not for text dumps with hundreds of
+// millions of coordinates: every value goes through the stream machinery and
+// a temporary std::string. The functions below parse a whole buffer of
+// whitespace-separated values in place with from_chars() (see frac.h), write
+// the results to an output iterator, and allocate nothing themselves.
+//
+// Each of them returns a std::from_chars_result: on success ptr == last and
+// ec is std::errc(); otherwise ptr points at the value that could not be
+// parsed and ec says why (std::errc::invalid_argument for malformed text,
+// std::errc::result_out_of_range for a value that does not fit in a Frac).
+// Everything before ptr has been written to the output.
+
+namespace frac_parse_internal {
+
+    constexpr bool
+    is_space(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' ||
+               c == '\v';
+    }
+
+    constexpr const char *
+    skip_space(const char *p, const char *last) {
+        while (p != last && is_space(*p)) {
+            ++p;
+        }
+        return p;
+    }
+
+    // Parses the next value, which has to be followed by whitespace or the
+    // end of the buffer.
+    inline std::from_chars_result
+    next(const char *&p, const char *last, Frac &value) {
+        auto result = from_chars(p, last, value);
+        if (result.ec == std::errc() && result.ptr != last &&
+            !is_space(*result.ptr)) {
+            result = {p, std::errc::invalid_argument};
+        }
+        if (result.ec == std::errc()) {
+            p = skip_space(result.ptr, last);
+        } else {
+            result.ptr = p;
+        }
+        return result;
+    }
+
+}
+
+// Parses fractions, writing each of them to out.
+template <typename OutputIterator>
+std::from_chars_result
+parse_fracs(const char *first, const char *last, OutputIterator out) {
+    const char *p = frac_parse_internal::skip_space(first, last);
+    Frac f;
+    while (p != last) {
+        if (auto r = frac_parse_internal::next(p, last, f);
+            r.ec != std::errc()) {
+            return r;
+        }
+        *out++ = f;
+    }
+    return {last, std::errc()};
+}
+
+// Parses pairs of fractions "x y" and writes make_point(x, y) for each. A
+// lone x at the end of the buffer is an error.
+template <typename OutputIterator, typename MakePoint>
+std::from_chars_result
+parse_points(const char *first, const char *last, OutputIterator out,
+             MakePoint make_point) {
+    const char *p = frac_parse_internal::skip_space(first, last);
+    Frac x, y;
+    while (p != last) {
+        const char *point_start = p;
+        if (auto r = frac_parse_internal::next(p, last, x);
+            r.ec != std::errc()) {
+            return r;
+        }
+        if (p == last) {
+            return {point_start, std::errc::invalid_argument};
+        }
+        if (auto r = frac_parse_internal::next(p, last, y);
+            r.ec != std::errc()) {
+            return r;
+        }
+        *out++ = make_point(x, y);
+    }
+    return {last, std::errc()};
+}
+
+template <typename OutputIterator>
+std::from_chars_result
+parse_frac_points(const char *first, const char *last, OutputIterator out) {
+    return parse_points(first, last, out, [](const Frac &x, const Frac &y) {
+        return FracPoint2(x, y);
+    });
+}
+
+// The exact value of a fraction as a number of the EPECK kernel. If the
+// value is a double (the numerator is exactly representable and the
+// denominator is a power of two), the FT is built from that double, which
+// needs no arbitrary precision arithmetic at all. Otherwise we divide the
+// components in the kernel's exact number type, and wrap the result.
+inline CGAL::Exact_predicates_exact_constructions_kernel::FT
+to_epeck_ft(const Frac &f) {
+    using FT = CGAL::Exact_predicates_exact_constructions_kernel::FT;
+    using ET = FT::Exact_type;
+    static_assert(sizeof(long) == sizeof(ll),
+                  "to_epeck_ft() assumes an LP64 platform");
+
+    const ll num = f.num(), den = f.den();
+    if (num >= -(static_cast<ll>(1) << 53) && num <= static_cast<ll>(1) << 53 &&
+        std::has_single_bit(static_cast<unsigned long long>(den))) {
+        return FT(static_cast<double>(num) / static_cast<double>(den));
+    }
+    return FT(ET(static_cast<long>(num)) / ET(static_cast<long>(den)));
+}
+
+template <typename OutputIterator>
+std::from_chars_result
+parse_epeck_points(const char *first, const char *last, OutputIterator out) {
+    using Point_2 = CGAL::Exact_predicates_exact_constructions_kernel::Point_2;
+    return parse_points(first, last, out, [](const Frac &x, const Frac &y) {
+        return Point_2(to_epeck_ft(x), to_epeck_ft(y));
+    });
+}
+
+#endif //CGAL_TUTORIAL_FRAC_PARSE_H
@@ -0,0 +1,333 @@
+#ifndef CGAL_TUTORIAL_FRAC_POINT_2_H
+#define CGAL_TUTORIAL_FRAC_POINT_2_H
+
+#include <bit>
+#include <functional>
+#include <ostream>
+#include <type_traits>
+
+#include "frac.h"
+#include "wide_int.h"
+
+// This is the FracPoint2 class from part-vii.cpp, built on top of the
+// overflow-safe Frac from frac.h.
+class FracPoint2 {
+public:
+
+    // The origin. A default constructor lets FracPoint2 live in a std::array,
+    // which is what we need for hulls computed at compile time.
+    constexpr FracPoint2() = default;
+
+    constexpr FracPoint2(Frac x, Frac y) : _x{x}, _y{y} {
+    }
+
+    [[nodiscard]] constexpr const Frac &
+    x() const {
+        return _x;
+    }
+
+    [[nodiscard]] constexpr const Frac &
+    y() const {
+        return _y;
+    }
+
+private:
+    Frac _x, _y;
+};
+
+inline std::ostream &
+operator <<(std::ostream &out, const FracPoint2 &p) {
+    out << "<" << p.x() << ", " << p.y() << ">";
+    return out;
+}
+
+// Returns the sign (-1, 0 or +1) of cross(p1 - p0, p2 - p0), i.e. the
+// orientation of the three points, without building a single intermediate
+// Frac.
+//
+// Writing xi = xni / xdi and yi = yni / ydi, the differences are
+//    x1 - x0 = dx1 / (xd0 * xd1)  with  dx1 = xn1 * xd0 - xn0 * xd1,
+// and likewise for dx2, dy1 and dy2. Multiplying the determinant
+//    (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0)
+// by the common denominator D = xd0 * xd1 * xd2 * yd0 * yd1 * yd2 gives
+//    dx1 * dy2 * xd2 * yd1 - dx2 * dy1 * xd1 * yd2,
+// whose sign is the answer, since denominators are positive. If numerators
+// have at most bn bits and denominators at most bd bits, that expression has
+// at most 2 * bn + 4 * bd + 3 bits, so for the common case of modest
+// components we evaluate it in __int128, and otherwise in a 384-bit WideInt.
+//
+// For integer points, bd is 1 (the denominators are positive, so their
+// bitwise or is 1 only if all of them are), and the sign is that of
+//    (xn1 - xn0) * (yn2 - yn0) - (xn2 - xn0) * (yn1 - yn0),
+// which has at most 2 * bn + 3 bits.
+[[nodiscard]] constexpr int
+orientation(const FracPoint2 &p0, const FracPoint2 &p1, const FracPoint2 &p2) {
+    const ll xn0 = p0.x().num(), xd0 = p0.x().den();
+    const ll yn0 = p0.y().num(), yd0 = p0.y().den();
+    const ll xn1 = p1.x().num(), xd1 = p1.x().den();
+    const ll yn1 = p1.y().num(), yd1 = p1.y().den();
+    const ll xn2 = p2.x().num(), xd2 = p2.x().den();
+    const ll yn2 = p2.y().num(), yd2 = p2.y().den();
+
+    // Frac never stores LLONG_MIN, so the negation is safe here.
+    auto mag = [](ll v) {
+        return static_cast<unsigned long long>(v < 0 ? -v : v);
+    };
+    const int bn = std::bit_width(mag(xn0) | mag(yn0) | mag(xn1) | mag(yn1) |
+                                  mag(xn2) | mag(yn2));
+    const int bd = std::bit_width(static_cast<unsigned long long>(
+        xd0 | yd0 | xd1 | yd1 | xd2 | yd2));
+
+    if (bd == 1 && bn <= 62) {
+        i128 dx1 = static_cast<i128>(xn1) - xn0;
+        i128 dy1 = static_cast<i128>(yn1) - yn0;
+        i128 dx2 = static_cast<i128>(xn2) - xn0;
+        i128 dy2 = static_cast<i128>(yn2) - yn0;
+        i128 det = dx1 * dy2 - dx2 * dy1;
+        return (det > 0) - (det < 0);
+    }
+
+    if (2 * bn + 4 * bd + 3 <= 127) {
+        i128 dx1 = static_cast<i128>(xn1) * xd0 - static_cast<i128>(xn0) * xd1;
+        i128 dy1 = static_cast<i128>(yn1) * yd0 - static_cast<i128>(yn0) * yd1;
+        i128 dx2 = static_cast<i128>(xn2) * xd0 - static_cast<i128>(xn0) * xd2;
+        i128 dy2 = static_cast<i128>(yn2) * yd0 - static_cast<i128>(yn0) * yd2;
+        i128 det = dx1 * dy2 * xd2 * yd1 - dx2 * dy1 * xd1 * yd2;
+        return (det > 0) - (det < 0);
+    }
+
+    using W = WideInt<6>;
+    W dx1 = W(static_cast<i128>(xn1) * xd0) - W(static_cast<i128>(xn0) * xd1);
+    W dy1 = W(static_cast<i128>(yn1) * yd0) - W(static_cast<i128>(yn0) * yd1);
+    W dx2 = W(static_cast<i128>(xn2) * xd0) - W(static_cast<i128>(xn0) * xd2);
+    W dy2 = W(static_cast<i128>(yn2) * yd0) - W(static_cast<i128>(yn0) * yd2);
+    W det = dx1 * dy2 * W(static_cast<i128>(xd2) * yd1) -
+            dx2 * dy1 * W(static_cast<i128>(xd1) * yd2);
+    return det.sign();
+}
+
+// Returns the sign of the cross product p.x() * q.y() - q.x() * p.y(), again
+// straight from the components: multiplied by the four denominators, it is
+//    pxn * qyn * qxd * pyd - qxn * pyn * pxd * qyd,
+// which has at most 2 * bn + 2 * bd + 1 bits.
+[[nodiscard]] constexpr int
+cross_sign(const FracPoint2 &p, const FracPoint2 &q) {
+    const ll pxn = p.x().num(), pxd = p.x().den();
+    const ll pyn = p.y().num(), pyd = p.y().den();
+    const ll qxn = q.x().num(), qxd = q.x().den();
+    const ll qyn = q.y().num(), qyd = q.y().den();
+
+    auto mag = [](ll v) {
+        return static_cast<unsigned long long>(v < 0 ? -v : v);
+    };
+    const int bn = std::bit_width(mag(pxn) | mag(pyn) | mag(qxn) | mag(qyn));
+    const int bd = std::bit_width(
+        static_cast<unsigned long long>(pxd | pyd | qxd | qyd));
+
+    if (2 * bn + 2 * bd + 1 <= 127) {
+        i128 det = static_cast<i128>(pxn) * qyn * qxd * pyd -
+                   static_cast<i128>(qxn) * pyn * pxd * qyd;
+        return (det > 0) - (det < 0);
+    }
+
+    using W = WideInt<4>;
+    W det = W(static_cast<i128>(pxn) * qyn) * W(static_cast<i128>(qxd) * pyd) -
+            W(static_cast<i128>(qxn) * pyn) * W(static_cast<i128>(pxd) * qyd);
+    return det.sign();
+}
+
+// Point arithmetic. In part-vii.cpp every +, -, * and / on points, and
+// cross(), returned a new point or fraction, so an expression like
+// cross(p1 - p0, p2 - p0) built two points and a fraction (and, in the toy
+// version, reduced each of them). Here the operators return small expression
+// objects instead, which record what is to be computed and convert to a
+// FracPoint2 when a point is needed:
+//
+//    FracPoint2 m = (p + q) / 2;              // evaluated once, here
+//    bool left = cross(p1 - p0, p2 - p0).positive();
+//
+// cross() returns an expression too. Converting it to a Frac evaluates it
+// and normalizes the result once. Asking for its sign() or positive()
+// evaluates nothing at all when both sides are differences from the same
+// point (the sign is orientation() then), and otherwise only evaluates the
+// two sides and takes cross_sign().
+//
+// Since the expressions keep references to the FracPoint2 objects they were
+// built from, an expression must not outlive its operands; store the result
+// in a FracPoint2 (or Frac), not in an auto variable, if the operands are
+// temporaries.
+namespace frac_point_expr {
+
+    template <typename T>
+    concept Point_expression =
+        std::is_same_v<T, FracPoint2> ||
+        requires { typename T::is_point_expression; };
+
+    // FracPoint2 operands are held by reference, expressions by value.
+    template <typename T>
+    using Stored = std::conditional_t<std::is_same_v<T, FracPoint2>,
+                                      const FracPoint2 &, T>;
+
+    // l + r or l - r, depending on Op.
+    template <typename L, typename R, typename Op>
+    class Combination {
+    public:
+        using is_point_expression = void;
+
+        constexpr Combination(const L &l, const R &r): _l{l}, _r{r} {
+        }
+
+        [[nodiscard]] constexpr Frac
+        x() const {
+            return Op()(_l.x(), _r.x());
+        }
+
+        [[nodiscard]] constexpr Frac
+        y() const {
+            return Op()(_l.y(), _r.y());
+        }
+
+        constexpr
+        operator FracPoint2() const {
+            return {x(), y()};
+        }
+
+        [[nodiscard]] constexpr const L &
+        lhs() const {
+            return _l;
+        }
+
+        [[nodiscard]] constexpr const R &
+        rhs() const {
+            return _r;
+        }
+
+    private:
+        Stored<L> _l;
+        Stored<R> _r;
+    };
+
+    // e * s or e / s, depending on Op.
+    template <typename E, typename Op>
+    class Scaled {
+    public:
+        using is_point_expression = void;
+
+        constexpr Scaled(const E &e, const Frac &s): _e{e}, _s{s} {
+        }
+
+        [[nodiscard]] constexpr Frac
+        x() const {
+            return Op()(_e.x(), _s);
+        }
+
+        [[nodiscard]] constexpr Frac
+        y() const {
+            return Op()(_e.y(), _s);
+        }
+
+        constexpr
+        operator FracPoint2() const {
+            return {x(), y()};
+        }
+
+    private:
+        Stored<E> _e;
+        Frac _s;
+    };
+
+    template <typename T>
+    constexpr bool is_difference_of_points = false;
+
+    template <>
+    constexpr bool is_difference_of_points<
+        Combination<FracPoint2, FracPoint2, std::minus<>>> = true;
+
+    // The cross product of two point expressions.
+    template <typename P, typename Q>
+    class Cross {
+    public:
+        constexpr Cross(const P &p, const Q &q): _p{p}, _q{q} {
+        }
+
+        // Returns -1, 0 or +1.
+        [[nodiscard]] constexpr int
+        sign() const {
+            if constexpr (is_difference_of_points<P> &&
+                          is_difference_of_points<Q>) {
+                const FracPoint2 &a = _p.rhs(), &b = _q.rhs();
+                if (&a == &b || (a.x().num() == b.x().num() &&
+                                 a.x().den() == b.x().den() &&
+                                 a.y().num() == b.y().num() &&
+                                 a.y().den() == b.y().den())) {
+                    return orientation(a, _p.lhs(), _q.lhs());
+                }
+            }
+            return cross_sign(_p, _q);
+        }
+
+        [[nodiscard]] constexpr bool
+        positive() const {
+            return sign() > 0;
+        }
+
+        // The value of the cross product, in lowest terms.
+        [[nodiscard]] constexpr Frac
+        value() const {
+            const FracPoint2 p = _p, q = _q;
+            return (p.x() * q.y() - q.x() * p.y()).normalized();
+        }
+
+        constexpr
+        operator Frac() const {
+            return value();
+        }
+
+    private:
+        Stored<P> _p;
+        Stored<Q> _q;
+    };
+
+}
+
+template <frac_point_expr::Point_expression L,
+          frac_point_expr::Point_expression R>
+[[nodiscard]] constexpr auto
+operator +(const L &p, const R &q) {
+    return frac_point_expr::Combination<L, R, std::plus<>>(p, q);
+}
+
+template <frac_point_expr::Point_expression L,
+          frac_point_expr::Point_expression R>
+[[nodiscard]] constexpr auto
+operator -(const L &p, const R &q) {
+    return frac_point_expr::Combination<L, R, std::minus<>>(p, q);
+}
+
+template <frac_point_expr::Point_expression E>
+[[nodiscard]] constexpr auto
+operator *(const Frac &s, const E &p) {
+    return frac_point_expr::Scaled<E, std::multiplies<>>(p, s);
+}
+
+template <frac_point_expr::Point_expression E>
+[[nodiscard]] constexpr auto
+operator *(const E &p, const Frac &s) {
+    return frac_point_expr::Scaled<E, std::multiplies<>>(p, s);
+}
+
+template <frac_point_expr::Point_expression E>
+[[nodiscard]] constexpr auto
+operator /(const E &p, const Frac &s) {
+    return frac_point_expr::Scaled<E, std::divides<>>(p, s);
+}
+
+// The two-dimensional 'cross product' of two points or point expressions.
+template <frac_point_expr::Point_expression P,
+          frac_point_expr::Point_expression Q>
+[[nodiscard]] constexpr auto
+cross(const P &p, const Q &q) {
+    return frac_point_expr::Cross<P, Q>(p, q);
+}
+
+#endif //CGAL_TUTORIAL_FRAC_POINT_2_H
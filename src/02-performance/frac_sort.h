@@ -0,0 +1,271 @@
+#ifndef CGAL_TUTORIAL_FRAC_SORT_H
+#define CGAL_TUTORIAL_FRAC_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "frac_traits.h"
+
+// Most of the time of CGAL::ch_graham_andrew() goes into sorting the points
+// with Less_xy_2, and every call of Less_xy_2 cross-multiplies the components
+// of two points in 128 bits and branches on the result. sort_xy() below sorts
+// the same points without calling Less_xy_2 for almost all of them.
+//
+// The idea is that a double key can stand in for a fraction. If |num| and
+// |den| are at most 2^53, both convert to double exactly, and num / den is
+// then the correctly rounded quotient. Rounding is monotone, so
+//    x < x'  implies  key(x) <= key(x'),
+// i.e. whenever two keys differ they order the fractions correctly, and only
+// points whose keys are equal need an exact comparison. The keys are turned
+// into unsigned integers with the same order and stored, with the index of
+// their point, in a separate contiguous array, which is sorted by
+// (key(x), key(y)) with a radix sort that does not compare fractions at all.
+// Then the points are gathered in that order, and each run of points with
+// equal keys - exact duplicates, or fractions closer than a double can tell
+// apart - is put in order with the exact Less_xy_2.
+//
+// If a component is too large for the keys to be trusted, sort_xy() falls
+// back to std::sort() with Less_xy_2.
+
+namespace frac_sort_internal {
+
+    constexpr ll exact_limit = static_cast<ll>(1) << 53;
+
+    // The keys of a point and its index in the input.
+    struct Keyed {
+        std::uint64_t x, y;
+        std::uint32_t index;
+
+        friend bool
+        operator <(const Keyed &a, const Keyed &b) {
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        }
+    };
+
+    constexpr bool
+    exact_as_double(ll v) {
+        return v >= -exact_limit && v <= exact_limit;
+    }
+
+    // The key of a fraction: num / den as a double, mapped to an unsigned
+    // integer with the same order. The denominator is positive, so zero is
+    // always +0.0, and flipping the bits of negative doubles (and the sign bit
+    // of the others) makes the integer order match the double order.
+    constexpr std::uint64_t
+    key(const Frac &f) {
+        double q = static_cast<double>(f.num()) / static_cast<double>(f.den());
+        auto bits = std::bit_cast<std::uint64_t>(q);
+        std::uint64_t mask = static_cast<std::uint64_t>(
+            static_cast<std::int64_t>(bits) >> 63) | (1ULL << 63);
+        return bits ^ mask;
+    }
+
+    // Computes the keys of all the points into keys, one contiguous array of
+    // small records. Returns false if a component is larger than 2^53, in
+    // which case the keys cannot be trusted.
+    template <typename RandomAccessIterator>
+    bool
+    compute_keys(RandomAccessIterator first, std::size_t n, Keyed *keys) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const FracPoint2 &p = first[i];
+            if (!exact_as_double(p.x().num()) ||
+                !exact_as_double(p.x().den()) ||
+                !exact_as_double(p.y().num()) ||
+                !exact_as_double(p.y().den())) {
+                return false;
+            }
+            keys[i] = {key(p.x()), key(p.y()), static_cast<std::uint32_t>(i)};
+        }
+        return true;
+    }
+
+    constexpr int max_radix_bits = 11;
+    constexpr std::size_t small_range = 32;
+
+    // Sorts keys[0, n) by (x, y), with tmp[0, n) as scratch space. This is a
+    // most significant digit radix sort on x - lo, where lo is the smallest
+    // x key: the keys are distributed into at most 2^11 buckets by the
+    // leading bits of x - lo, and the buckets are sorted recursively, until
+    // they are small enough for an insertion sort or all their x keys are
+    // equal. Each level looks at fewer keys, so after the first level or two
+    // everything stays in cache. The leading bits of an integer key hold the
+    // sign and exponent of the double, so the buckets follow the values on a
+    // roughly logarithmic scale, which also copes with heavy-tailed inputs
+    // such as quotients of random integers.
+    template <std::uint64_t Keyed::*Key = &Keyed::x>
+    void
+    radix_sort(Keyed *keys, Keyed *tmp, std::size_t n) {
+        if (n <= small_range) {
+            for (std::size_t i = 1; i < n; ++i) {
+                Keyed k = keys[i];
+                std::size_t j = i;
+                for (; j > 0 && k < keys[j - 1]; --j) {
+                    keys[j] = keys[j - 1];
+                }
+                keys[j] = k;
+            }
+            return;
+        }
+
+        std::uint64_t lo = keys[0].*Key, hi = keys[0].*Key;
+        for (std::size_t i = 1; i < n; ++i) {
+            lo = std::min(lo, keys[i].*Key);
+            hi = std::max(hi, keys[i].*Key);
+        }
+        if (lo == hi) {
+            if constexpr (Key == &Keyed::x) {
+                radix_sort<&Keyed::y>(keys, tmp, n);
+            }
+            return;
+        }
+
+        const int radix_bits = std::min(
+            max_radix_bits, static_cast<int>(std::bit_width(n / 8)));
+        const int shift = std::max(
+            0, static_cast<int>(std::bit_width(hi - lo)) - radix_bits);
+        const std::size_t n_buckets = ((hi - lo) >> shift) + 1;
+        auto bucket = [&](std::uint64_t x) {
+            return static_cast<std::size_t>((x - lo) >> shift);
+        };
+
+        std::array<std::size_t, (std::size_t{1} << max_radix_bits) + 1> start;
+        std::fill(start.begin(), start.begin() + n_buckets + 1, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            ++start[bucket(keys[i].*Key) + 1];
+        }
+        for (std::size_t b = 0; b < n_buckets; ++b) {
+            start[b + 1] += start[b];
+        }
+        std::array<std::size_t, std::size_t{1} << max_radix_bits> next;
+        std::copy(start.begin(), start.begin() + n_buckets, next.begin());
+        for (std::size_t i = 0; i < n; ++i) {
+            tmp[next[bucket(keys[i].*Key)]++] = keys[i];
+        }
+        std::copy(tmp, tmp + n, keys);
+
+        for (std::size_t b = 0; b < n_buckets; ++b) {
+            radix_sort<Key>(keys + start[b], tmp + start[b],
+                            start[b + 1] - start[b]);
+        }
+    }
+
+}
+
+// Returns the points in [first, last) sorted with FracTraits::Less_xy_2. The
+// order of points that are equal is unspecified, as with std::sort().
+template <typename RandomAccessIterator>
+std::vector<FracPoint2>
+sorted_xy(RandomAccessIterator first, RandomAccessIterator last) {
+    using namespace frac_sort_internal;
+    const auto less_xy = FracTraits().less_xy_2_object();
+    const auto n = static_cast<std::size_t>(last - first);
+
+    auto fallback = [&] {
+        std::vector<FracPoint2> points(first, last);
+        std::sort(points.begin(), points.end(), less_xy);
+        return points;
+    };
+    if (n < 2 || n > std::numeric_limits<std::uint32_t>::max()) {
+        return fallback();
+    }
+
+    auto key_storage = std::make_unique_for_overwrite<Keyed[]>(n);
+    Keyed *keys = key_storage.get();
+    if (!compute_keys(first, n, keys)) {
+        return fallback();
+    }
+    auto scratch = std::make_unique_for_overwrite<Keyed[]>(n);
+    radix_sort(keys, scratch.get(), n);
+
+    std::vector<FracPoint2> points;
+    points.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        points.push_back(first[keys[i].index]);
+    }
+
+    // The points are now in order wherever the keys differ. Within a run of
+    // equal x keys the order is still right if the x values are all the same
+    // (then the y keys decided), apart from runs of equal y keys too, which
+    // we sort exactly. If the x values in the run differ, the y keys may
+    // have put them in the wrong order, and we sort the whole run exactly.
+    auto sort_exactly = [&](std::size_t begin, std::size_t end) {
+        if (end - begin > 1) {
+            std::sort(points.begin() + begin, points.begin() + end, less_xy);
+        }
+    };
+    std::size_t run_start = 0;
+    for (std::size_t i = 1; i <= n; ++i) {
+        if (i < n && keys[i].x == keys[run_start].x) {
+            continue;
+        }
+        if (i - run_start > 1) {
+            bool same_x = true;
+            for (std::size_t j = run_start + 1; same_x && j < i; ++j) {
+                same_x = points[j].x() == points[run_start].x();
+            }
+            if (same_x) {
+                std::size_t y_run_start = run_start;
+                for (std::size_t j = run_start + 1; j <= i; ++j) {
+                    if (j == i || keys[j].y != keys[y_run_start].y) {
+                        sort_exactly(y_run_start, j);
+                        y_run_start = j;
+                    }
+                }
+            } else {
+                sort_exactly(run_start, i);
+            }
+        }
+        run_start = i;
+    }
+    return points;
+}
+
+// Sorts the points with FracTraits::Less_xy_2.
+inline void
+sort_xy(std::vector<FracPoint2> &points) {
+    points = sorted_xy(points.begin(), points.end());
+}
+
+// CGAL::ch_graham_andrew() with the sort replaced by sort_xy(); the scans are
+// CGAL's own, so the result is the same. The scans rely on the points being
+// sorted in the order of the Less_xy_2 of traits, and sort_xy() always sorts
+// in that of FracTraits, so traits have to share its Less_xy_2.
+template <typename InputIterator, typename OutputIterator,
+          typename Traits = FracTraits>
+OutputIterator
+frac_ch_graham_andrew(InputIterator first, InputIterator last,
+                      OutputIterator result, const Traits &traits = Traits()) {
+    static_assert(std::is_same_v<typename Traits::Less_xy_2,
+                                 FracTraits::Less_xy_2>,
+                  "frac_ch_graham_andrew sorts with FracTraits::Less_xy_2");
+    std::vector<FracPoint2> points;
+    if constexpr (std::random_access_iterator<InputIterator>) {
+        points = sorted_xy(first, last);
+    } else {
+        std::vector<FracPoint2> copy(first, last);
+        points = sorted_xy(copy.begin(), copy.end());
+    }
+    if (points.empty()) {
+        return result;
+    }
+    if (traits.equal_2_object()(points.front(), points.back())) {
+        *result = points.front();
+        return ++result;
+    }
+    result = CGAL::ch_graham_andrew_scan(points.begin(), points.end(), result,
+                                         traits);
+    return CGAL::ch_graham_andrew_scan(points.rbegin(), points.rend(), result,
+                                       traits);
+}
+
+#endif //CGAL_TUTORIAL_FRAC_SORT_H
@@ -0,0 +1,65 @@
+#ifndef CGAL_TUTORIAL_FRAC_TRAITS_H
+#define CGAL_TUTORIAL_FRAC_TRAITS_H
+
+#include "frac_point_2.h"
+
+// The traits class from part-vii.cpp for the overflow-safe FracPoint2. It
+// provides everything CGAL::ch_graham_andrew() needs:
+//    * Traits::Point_2
+//    * Traits::Less_xy_2   - responsible for sorting
+//    * Traits::Left_turn_2 - responsible for orientation
+//    * Traits::Equal_2
+class FracTraits {
+public:
+
+    using Point_2 = FracPoint2;
+
+    // Lexicographic order. We use the three-way Frac::compare() so that the x
+    // components are only cross-multiplied once.
+    class Less_xy_2 {
+    public:
+        constexpr bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            int cx = p.x().compare(q.x());
+            return cx < 0 || (cx == 0 && p.y() < q.y());
+        }
+    };
+
+    // Rather than building the differences p1 - p0 and p2 - p0 and their
+    // cross product as normalized fractions, we find the sign of the
+    // determinant directly from the numerators and denominators (see
+    // orientation() in frac_point_2.h).
+    class Left_turn_2 {
+    public:
+        constexpr bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            return orientation(p0, p1, p2) > 0;
+        }
+    };
+
+    class Equal_2 {
+    public:
+        constexpr bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            return p.x() == q.x() && p.y() == q.y();
+        }
+    };
+
+    [[nodiscard]] constexpr Less_xy_2
+    less_xy_2_object() const {
+        return {};
+    }
+
+    [[nodiscard]] constexpr Left_turn_2
+    left_turn_2_object() const {
+        return {};
+    }
+
+    [[nodiscard]] constexpr Equal_2
+    equal_2_object() const {
+        return {};
+    }
+};
+
+#endif //CGAL_TUTORIAL_FRAC_TRAITS_H
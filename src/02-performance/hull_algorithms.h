@@ -0,0 +1,134 @@
+#ifndef CGAL_TUTORIAL_HULL_ALGORITHMS_H
+#define CGAL_TUTORIAL_HULL_ALGORITHMS_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "chan_hull.h"
+#include "hull_prefilter.h"
+#include "parallel_hull.h"
+
+// The 2D hull algorithms as function objects, so that the algorithm can be
+// chosen with a template parameter, and hull_2(), which runs one of them
+// behind a prefilter (see hull_prefilter.h):
+//
+//    Prefilter_statistics statistics;
+//    hull_2<Akl_toussaint_prefilter>(points.begin(), points.end(),
+//                                    std::back_inserter(hull), Traits(),
+//                                    &statistics);
+//
+// Graham_andrew and Chan only need Less_xy_2, Left_turn_2 and Equal_2, so
+// they also work with the Traits of part-vii.cpp; the others need a full CGAL hull
+// traits class such as a kernel.
+
+struct Graham_andrew {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return CGAL::ch_graham_andrew(first, last, result, traits);
+    }
+};
+
+struct Akl_toussaint {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return CGAL::ch_akl_toussaint(first, last, result, traits);
+    }
+};
+
+struct Bykat {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return CGAL::ch_bykat(first, last, result, traits);
+    }
+};
+
+struct Eddy {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return CGAL::ch_eddy(first, last, result, traits);
+    }
+};
+
+struct Jarvis {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return CGAL::ch_jarvis(first, last, result, traits);
+    }
+};
+
+// Only correct if the points are the vertices of a simple polyline, in
+// order.
+struct Melkman {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return CGAL::ch_melkman(first, last, result, traits);
+    }
+};
+
+struct Parallel_hull {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return parallel_convex_hull_2(first, last, result, traits);
+    }
+};
+
+struct Chan {
+    template <typename InputIterator, typename OutputIterator, typename Traits>
+    OutputIterator
+    operator()(InputIterator first, InputIterator last, OutputIterator result,
+               const Traits &traits) const {
+        return ch_chan(first, last, result, traits);
+    }
+};
+
+struct Prefilter_statistics {
+    std::size_t n_input = 0;
+    std::size_t n_discarded = 0;
+};
+
+// Computes the hull of [first, last) with Algorithm, after Prefilter has
+// removed the points it can. If statistics is given, it receives the number
+// of input points and of points the prefilter discarded.
+template <typename Prefilter = No_prefilter, typename Algorithm = Graham_andrew,
+          typename InputIterator, typename OutputIterator, typename Traits>
+OutputIterator
+hull_2(InputIterator first, InputIterator last, OutputIterator result,
+       const Traits &traits, Prefilter_statistics *statistics = nullptr) {
+    if constexpr (std::is_same_v<Prefilter, No_prefilter>) {
+        if (statistics) {
+            statistics->n_input = static_cast<std::size_t>(
+                std::distance(first, last));
+            statistics->n_discarded = 0;
+        }
+        return Algorithm()(first, last, result, traits);
+    } else {
+        std::vector<typename Traits::Point_2> points(first, last);
+        const std::size_t n_input = points.size();
+        const std::size_t n_discarded = Prefilter()(points, traits);
+        if (statistics) {
+            statistics->n_input = n_input;
+            statistics->n_discarded = n_discarded;
+        }
+        return Algorithm()(points.begin(), points.end(), result, traits);
+    }
+}
+
+#endif //CGAL_TUTORIAL_HULL_ALGORITHMS_H
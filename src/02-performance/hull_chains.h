@@ -0,0 +1,155 @@
+#ifndef CGAL_TUTORIAL_HULL_CHAINS_H
+#define CGAL_TUTORIAL_HULL_CHAINS_H
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// The Graham-Andrew algorithm splits the hull of a set of points, sorted with
+// Less_xy_2, into two monotone chains: the lower chain runs from the smallest
+// point to the largest, the upper chain from the largest back to the
+// smallest. This header keeps the two chains as a value, so that hulls of
+// consecutive runs of sorted points can be computed independently and joined
+// afterwards.
+//
+// Two such hulls are separated: every point of the left one is smaller than
+// every point of the right one. The lower chain of their union is then a
+// prefix of the left lower chain, a bridge, and a suffix of the right lower
+// chain, and likewise for the upper chains; finding the bridge - the common
+// tangent of the two hulls - only walks over the points the join removes.
+//
+// All the functions take the traits class of CGAL's 2D convex hull functions
+// and only use its Less_xy_2 (through the sorted input), Left_turn_2 and
+// Equal_2. As in CGAL::ch_graham_andrew(), a point is a hull vertex only if
+// the hull turns strictly left there, so duplicate and collinear points are
+// dropped, and the result is exactly that of CGAL::ch_graham_andrew().
+
+template <typename Point>
+struct HullChains {
+    // The lower chain from the smallest to the largest point, and the upper
+    // chain from the largest to the smallest. Both are empty for an empty
+    // set of points.
+    std::vector<Point> lower, upper;
+
+    [[nodiscard]] bool
+    empty() const {
+        return lower.empty();
+    }
+};
+
+// Andrew's scan over [first, last), which has to be sorted: returns the
+// chain from *first to the last point that keeps only strict left turns.
+// Scanning the points backwards gives the upper chain.
+template <typename BidirectionalIterator, typename Traits>
+std::vector<typename Traits::Point_2>
+monotone_chain(BidirectionalIterator first, BidirectionalIterator last,
+               const Traits &traits) {
+    auto left_turn = traits.left_turn_2_object();
+    std::vector<typename Traits::Point_2> chain;
+    for (; first != last; ++first) {
+        while (chain.size() >= 2 &&
+               !left_turn(chain[chain.size() - 2], chain.back(), *first)) {
+            chain.pop_back();
+        }
+        chain.push_back(*first);
+    }
+    return chain;
+}
+
+// The chains of the points in [first, last), which have to be sorted with
+// Less_xy_2.
+template <typename BidirectionalIterator, typename Traits>
+HullChains<typename Traits::Point_2>
+hull_chains(BidirectionalIterator first, BidirectionalIterator last,
+            const Traits &traits) {
+    HullChains<typename Traits::Point_2> chains;
+    chains.lower = monotone_chain(first, last, traits);
+    chains.upper = monotone_chain(std::make_reverse_iterator(last),
+                                  std::make_reverse_iterator(first), traits);
+    return chains;
+}
+
+// Finds the bridge between two chains that turn the same way, where every
+// point of first comes before every point of second: returns (i, j) such
+// that first[0, i], second[j, end) is the joined chain. We start from the
+// two innermost points and move each end of the bridge outwards while the
+// other chain does not turn strictly left there; each step removes a point
+// for good, so this takes as many steps as there are points to remove.
+template <typename Point, typename Traits>
+std::pair<std::size_t, std::size_t>
+bridge(const std::vector<Point> &first, const std::vector<Point> &second,
+       const Traits &traits) {
+    auto left_turn = traits.left_turn_2_object();
+    std::size_t i = first.size() - 1, j = 0;
+    for (bool moved = true; moved;) {
+        moved = false;
+        while (i > 0 && !left_turn(first[i - 1], first[i], second[j])) {
+            --i;
+            moved = true;
+        }
+        while (j + 1 < second.size() &&
+               !left_turn(first[i], second[j], second[j + 1])) {
+            ++j;
+            moved = true;
+        }
+    }
+    return {i, j};
+}
+
+template <typename Point, typename Traits>
+std::vector<Point>
+join_chains(const std::vector<Point> &first, const std::vector<Point> &second,
+            const Traits &traits) {
+    auto [i, j] = bridge(first, second, traits);
+    std::vector<Point> chain;
+    chain.reserve(i + 1 + second.size() - j);
+    chain.insert(chain.end(), first.begin(), first.begin() + i + 1);
+    chain.insert(chain.end(), second.begin() + j, second.end());
+    return chain;
+}
+
+// Joins the chains of two separated sets of points, where every point of
+// left is smaller than every point of right. The upper chains run from right
+// to left, so there the right chain comes first.
+template <typename Point, typename Traits>
+HullChains<Point>
+join(const HullChains<Point> &left, const HullChains<Point> &right,
+     const Traits &traits) {
+    if (left.empty()) {
+        return right;
+    }
+    if (right.empty()) {
+        return left;
+    }
+    HullChains<Point> chains;
+    chains.lower = join_chains(left.lower, right.lower, traits);
+    chains.upper = join_chains(right.upper, left.upper, traits);
+    return chains;
+}
+
+// Writes the hull counterclockwise from the smallest point, as
+// CGAL::ch_graham_andrew() does: the lower chain without its last point,
+// then the upper chain without its last point. If all the points are equal
+// the hull is that one point.
+template <typename Point, typename OutputIterator, typename Traits>
+OutputIterator
+write_hull(const HullChains<Point> &chains, OutputIterator result,
+           const Traits &traits) {
+    if (chains.empty()) {
+        return result;
+    }
+    if (traits.equal_2_object()(chains.lower.front(), chains.lower.back())) {
+        *result = chains.lower.front();
+        return ++result;
+    }
+    for (std::size_t i = 0; i + 1 < chains.lower.size(); ++i) {
+        *result++ = chains.lower[i];
+    }
+    for (std::size_t i = 0; i + 1 < chains.upper.size(); ++i) {
+        *result++ = chains.upper[i];
+    }
+    return result;
+}
+
+#endif //CGAL_TUTORIAL_HULL_CHAINS_H
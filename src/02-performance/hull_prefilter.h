@@ -0,0 +1,168 @@
+#ifndef CGAL_TUTORIAL_HULL_PREFILTER_H
+#define CGAL_TUTORIAL_HULL_PREFILTER_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <CGAL/number_utils.h>
+
+// Prefilters remove points that cannot be hull vertices before a hull
+// algorithm sees them. They are policies for hull_2() (see hull_algorithms.h):
+// a class with
+//    std::size_t operator()(std::vector<Point> &points, const Traits &) const
+// that removes some of the points and returns how many it removed. The order
+// of the remaining points does not matter, since every hull algorithm
+// returns the same hull for any order of its input.
+//
+// No_prefilter keeps every point. Akl_toussaint_prefilter is the throw-away
+// step of the Akl-Toussaint algorithm: it finds the extreme points in eight
+// directions - west, south-west, south, ..., north-west - and discards every
+// point strictly inside the octagon they span. For uniform inputs that is
+// almost all of them, and the hull algorithm only has to sort what is left.
+
+struct No_prefilter {
+    template <typename Point, typename Traits>
+    std::size_t
+    operator()(std::vector<Point> &, const Traits &) const {
+        return 0;
+    }
+};
+
+namespace hull_prefilter_internal {
+
+    // The coordinates of a point as doubles, within a few units in the last
+    // place: num() / den() for the fraction types, CGAL::to_double()
+    // otherwise.
+    template <typename Point>
+    std::array<double, 2>
+    approximate(const Point &p) {
+        if constexpr (requires { p.x().num(); p.x().den(); }) {
+            return {static_cast<double>(p.x().num()) /
+                        static_cast<double>(p.x().den()),
+                    static_cast<double>(p.y().num()) /
+                        static_cast<double>(p.y().den())};
+        } else {
+            return {CGAL::to_double(p.x()), CGAL::to_double(p.y())};
+        }
+    }
+
+}
+
+class Akl_toussaint_prefilter {
+public:
+
+    template <typename Point, typename Traits>
+    std::size_t
+    operator()(std::vector<Point> &points, const Traits &traits) const {
+        using hull_prefilter_internal::approximate;
+        const std::size_t n = points.size();
+        if (n < 16) {
+            return 0;
+        }
+
+        // One pass over the points: their approximations, and the extremes
+        // of x, y, x + y and x - y. Which points are the extremes only
+        // decides how much we discard, not whether that is correct (see
+        // below), so the approximations are good enough for it.
+        // The eight scores are updated with selects rather than branches, so
+        // that the compiler can keep them in vector registers.
+        std::vector<std::array<double, 2>> xy(n);
+        std::array<double, 8> best;
+        best.fill(-std::numeric_limits<double>::infinity());
+        std::array<std::size_t, 8> extreme{};
+        for (std::size_t i = 0; i < n; ++i) {
+            xy[i] = approximate(points[i]);
+            const double x = xy[i][0], y = xy[i][1];
+            // In counterclockwise order: the smallest x, x + y and y, the
+            // largest x - y, x, x + y and y, and the smallest x - y.
+            const std::array<double, 8> score = {
+                -x, -(x + y), -y, x - y, x, x + y, y, -(x - y)
+            };
+            for (int k = 0; k < 8; ++k) {
+                const bool better = score[k] > best[k];
+                best[k] = better ? score[k] : best[k];
+                extreme[k] = better ? i : extreme[k];
+            }
+        }
+
+        // The edges of the octagon, without those between equal points.
+        auto equal = traits.equal_2_object();
+        std::array<std::size_t, 8> vertex;
+        int n_vertices = 0;
+        for (int k = 0; k < 8; ++k) {
+            const std::size_t v = extreme[k];
+            if (n_vertices == 0 || !equal(points[vertex[n_vertices - 1]],
+                                          points[v])) {
+                vertex[n_vertices++] = v;
+            }
+        }
+        while (n_vertices > 1 &&
+               equal(points[vertex[n_vertices - 1]], points[vertex[0]])) {
+            --n_vertices;
+        }
+        if (n_vertices < 3) {
+            return 0;
+        }
+
+        // A point strictly to the left of every edge is strictly inside the
+        // hull of the octagon's vertices, and so is not a hull vertex. This
+        // holds even if rounding made us pick an octagon that is not quite
+        // convex: the region left of every edge is then smaller, but still
+        // inside. We first decide on the approximations, and only ask the
+        // exact Left_turn_2 when the approximate orientation is within
+        // tolerance of zero. The approximations are within a few units in
+        // the last place, so the error of an orientation is below
+        // 2^-45 max|coordinate|^2, and we use 2^-40 of it.
+        double max_abs = 0.0;
+        for (int k = 0; k < 8; ++k) {
+            max_abs = std::max(max_abs, std::abs(best[k]));
+        }
+        const double tolerance = std::ldexp(max_abs * max_abs, -40);
+
+        auto left_turn = traits.left_turn_2_object();
+        auto strictly_inside = [&](std::size_t i) {
+            bool certain = true;
+            for (int k = 0; k < n_vertices; ++k) {
+                const auto &a = xy[vertex[k]];
+                const auto &b = xy[vertex[(k + 1) % n_vertices]];
+                const double o = (b[0] - a[0]) * (xy[i][1] - a[1]) -
+                                 (b[1] - a[1]) * (xy[i][0] - a[0]);
+                if (o < -tolerance) {
+                    return false;
+                }
+                certain = certain && o > tolerance;
+            }
+            if (certain) {
+                return true;
+            }
+            for (int k = 0; k < n_vertices; ++k) {
+                if (!left_turn(points[vertex[k]],
+                               points[vertex[(k + 1) % n_vertices]],
+                               points[i])) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!strictly_inside(i)) {
+                if (kept != i) {
+                    points[kept] = std::move(points[i]);
+                }
+                ++kept;
+            }
+        }
+        points.erase(points.begin() + kept, points.end());
+        return n - kept;
+    }
+
+};
+
+#endif //CGAL_TUTORIAL_HULL_PREFILTER_H
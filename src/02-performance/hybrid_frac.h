@@ -0,0 +1,368 @@
+#ifndef CGAL_TUTORIAL_HYBRID_FRAC_H
+#define CGAL_TUTORIAL_HYBRID_FRAC_H
+
+#include <concepts>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <gmp.h>
+
+#include "frac.h"
+
+// Frac throws std::overflow_error once a result no longer fits in two long
+// longs, which happens quickly for long chains of + and * (for example when
+// hull points come out of repeated constructions). GMP rationals never
+// overflow, but every GMP number lives on the heap, so even 1/2 + 1/3 costs
+// allocations.
+//
+// HybridFrac combines the two. It occupies the same two 64-bit words as Frac,
+// and while a value fits it is stored inline and computed with the 128-bit
+// arithmetic of Frac. When a result does not fit, the value is promoted to a
+// heap allocated GMP rational (mpq_t) and the second word is set to zero to
+// mark this (an inline denominator is never zero). Results of GMP arithmetic
+// are demoted back to the inline form whenever they fit again, so a single
+// pathological intermediate does not make the rest of a computation slow.
+//
+// Inline values always have a positive denominator, but, as for Frac, they
+// are only reduced to lowest terms when they would otherwise not fit.
+class HybridFrac {
+public:
+
+    HybridFrac(): _num{0}, _den{1} {
+    }
+
+    template <std::integral T>
+    HybridFrac(T num): HybridFrac(Frac(num)) {
+    }
+
+    HybridFrac(ll num, ll den): HybridFrac(Frac(num, den)) {
+    }
+
+    HybridFrac(const Frac &f): _num{f.num()}, _den{f.den()} {
+    }
+
+    HybridFrac(const HybridFrac &other): _den{other._den} {
+        if (other.is_inline()) {
+            _num = other._num;
+        } else {
+            _big = new_mpq();
+            mpq_set(_big, other._big);
+        }
+    }
+
+    HybridFrac(HybridFrac &&other) noexcept: _den{other._den} {
+        if (other.is_inline()) {
+            _num = other._num;
+        } else {
+            _big = other._big;
+        }
+        other._num = 0;
+        other._den = 1;
+    }
+
+    HybridFrac &
+    operator =(HybridFrac other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~HybridFrac() {
+        if (!is_inline()) {
+            delete_mpq(_big);
+        }
+    }
+
+    // True while the value is stored in the two inline words, false once it
+    // has been promoted to a GMP rational.
+    [[nodiscard]] bool
+    is_inline() const {
+        return _den != 0;
+    }
+
+    [[nodiscard]] int
+    compare(const HybridFrac &other) const {
+        if (is_inline() && other.is_inline()) {
+            // Both denominators are positive, so no sign correction is needed.
+            i128 lhs = static_cast<i128>(_num) * other._den;
+            i128 rhs = static_cast<i128>(other._num) * _den;
+            return (lhs > rhs) - (lhs < rhs);
+        }
+        Mpq a(*this), b(other);
+        int c = mpq_cmp(a.get(), b.get());
+        return (c > 0) - (c < 0);
+    }
+
+    friend bool
+    operator <(const HybridFrac &a, const HybridFrac &b) {
+        return a.compare(b) < 0;
+    }
+
+    friend bool
+    operator >(const HybridFrac &a, const HybridFrac &b) {
+        return a.compare(b) > 0;
+    }
+
+    friend bool
+    operator <=(const HybridFrac &a, const HybridFrac &b) {
+        return a.compare(b) <= 0;
+    }
+
+    friend bool
+    operator >=(const HybridFrac &a, const HybridFrac &b) {
+        return a.compare(b) >= 0;
+    }
+
+    friend bool
+    operator ==(const HybridFrac &a, const HybridFrac &b) {
+        return a.compare(b) == 0;
+    }
+
+    // Each operator first tries the inline path: the exact 128-bit result,
+    // reduced if necessary, exactly as in Frac. Only if that does not fit, or
+    // if an operand is already a GMP rational, do we use GMP.
+    friend HybridFrac
+    operator +(const HybridFrac &a, const HybridFrac &b) {
+        if (a.is_inline() && b.is_inline()) {
+            return from_wide(
+                static_cast<i128>(a._num) * b._den +
+                static_cast<i128>(b._num) * a._den,
+                static_cast<i128>(a._den) * b._den
+            );
+        }
+        return gmp_op(a, b, mpq_add);
+    }
+
+    friend HybridFrac
+    operator -(const HybridFrac &a, const HybridFrac &b) {
+        if (a.is_inline() && b.is_inline()) {
+            return from_wide(
+                static_cast<i128>(a._num) * b._den -
+                static_cast<i128>(b._num) * a._den,
+                static_cast<i128>(a._den) * b._den
+            );
+        }
+        return gmp_op(a, b, mpq_sub);
+    }
+
+    friend HybridFrac
+    operator *(const HybridFrac &a, const HybridFrac &b) {
+        if (a.is_inline() && b.is_inline()) {
+            return from_wide(
+                static_cast<i128>(a._num) * b._num,
+                static_cast<i128>(a._den) * b._den
+            );
+        }
+        return gmp_op(a, b, mpq_mul);
+    }
+
+    friend HybridFrac
+    operator /(const HybridFrac &a, const HybridFrac &b) {
+        if (b.sign() == 0) {
+            throw std::domain_error("HybridFrac: division by zero");
+        }
+        if (a.is_inline() && b.is_inline()) {
+            return from_wide(
+                static_cast<i128>(a._num) * b._den,
+                static_cast<i128>(a._den) * b._num
+            );
+        }
+        return gmp_op(a, b, mpq_div);
+    }
+
+    HybridFrac &
+    operator +=(const HybridFrac &other) {
+        return *this = *this + other;
+    }
+
+    HybridFrac &
+    operator -=(const HybridFrac &other) {
+        return *this = *this - other;
+    }
+
+    HybridFrac &
+    operator *=(const HybridFrac &other) {
+        return *this = *this * other;
+    }
+
+    HybridFrac &
+    operator /=(const HybridFrac &other) {
+        return *this = *this / other;
+    }
+
+    // Returns -1, 0 or +1.
+    [[nodiscard]] int
+    sign() const {
+        if (is_inline()) {
+            return (_num > 0) - (_num < 0);
+        }
+        return mpq_sgn(_big);
+    }
+
+    [[nodiscard]] double
+    to_double() const {
+        if (is_inline()) {
+            return static_cast<double>(_num) / static_cast<double>(_den);
+        }
+        return mpq_get_d(_big);
+    }
+
+    friend std::ostream &
+    operator <<(std::ostream &out, const HybridFrac &f) {
+        if (f.is_inline()) {
+            return out << f._num << "/" << f._den;
+        }
+        char *s = mpq_get_str(nullptr, 10, f._big);
+        out << s;
+        void (*free_func)(void *, std::size_t);
+        mp_get_memory_functions(nullptr, nullptr, &free_func);
+        free_func(s, std::char_traits<char>::length(s) + 1);
+        return out;
+    }
+
+private:
+    // _num while the value is inline, _big once it is promoted. Only the
+    // active member may be read, so everything that copies the union checks
+    // is_inline() first.
+    union {
+        ll _num;
+        mpq_ptr _big;
+    };
+    ll _den;
+
+    void
+    swap(HybridFrac &other) noexcept {
+        if (is_inline() && other.is_inline()) {
+            std::swap(_num, other._num);
+        } else if (!is_inline() && !other.is_inline()) {
+            std::swap(_big, other._big);
+        } else {
+            HybridFrac &small = is_inline() ? *this : other;
+            HybridFrac &big = is_inline() ? other : *this;
+            const ll num = small._num;
+            small._big = big._big;
+            big._num = num;
+        }
+        std::swap(_den, other._den);
+    }
+
+    static mpq_ptr
+    new_mpq() {
+        auto q = new __mpq_struct;
+        mpq_init(q);
+        return q;
+    }
+
+    static void
+    delete_mpq(mpq_ptr q) {
+        mpq_clear(q);
+        delete q;
+    }
+
+    // Sets a GMP integer to a 128-bit value.
+    static void
+    set_mpz(mpz_ptr z, i128 v) {
+        unsigned __int128 m = v < 0 ? -static_cast<unsigned __int128>(v)
+                                    : static_cast<unsigned __int128>(v);
+        mpz_set_ui(z, static_cast<unsigned long>(m >> 64));
+        mpz_mul_2exp(z, z, 64);
+        mpz_add_ui(z, z, static_cast<unsigned long>(m));
+        if (v < 0) {
+            mpz_neg(z, z);
+        }
+    }
+
+    // A temporary GMP view of a HybridFrac: for a promoted value it just
+    // points at the existing mpq_t, for an inline one it builds a new one.
+    class Mpq {
+    public:
+        explicit
+        Mpq(const HybridFrac &f) {
+            if (f.is_inline()) {
+                mpq_init(_own);
+                set_mpz(mpq_numref(_own), f._num);
+                set_mpz(mpq_denref(_own), f._den);
+                mpq_canonicalize(_own);
+                _q = _own;
+            } else {
+                _q = f._big;
+            }
+        }
+
+        ~Mpq() {
+            if (_q == _own) {
+                mpq_clear(_own);
+            }
+        }
+
+        Mpq(const Mpq &) = delete;
+        Mpq &operator =(const Mpq &) = delete;
+
+        [[nodiscard]] mpq_srcptr
+        get() const {
+            return _q;
+        }
+
+    private:
+        mpq_t _own;
+        mpq_srcptr _q;
+    };
+
+    // The inline path: stores the exact quotient num / den if it fits in two
+    // long longs (after reduction if need be), and promotes it otherwise.
+    static HybridFrac
+    from_wide(i128 num, i128 den) {
+        if (den < 0) {
+            num = -num;
+            den = -den;
+        }
+        if (!frac_internal::fits(num) || !frac_internal::fits(den)) {
+            i128 g = frac_internal::gcd(num, den);
+            num /= g;
+            den /= g;
+        }
+        HybridFrac r;
+        if (frac_internal::fits(num) && frac_internal::fits(den)) {
+            r._num = static_cast<ll>(num);
+            r._den = static_cast<ll>(den);
+            return r;
+        }
+        r._big = new_mpq();
+        r._den = 0;
+        set_mpz(mpq_numref(r._big), num);
+        set_mpz(mpq_denref(r._big), den);
+        mpq_canonicalize(r._big);
+        return r;
+    }
+
+    // The GMP path. The result is demoted to the inline form if it fits.
+    static HybridFrac
+    gmp_op(const HybridFrac &a, const HybridFrac &b,
+           void (*op)(mpq_ptr, mpq_srcptr, mpq_srcptr)) {
+        Mpq qa(a), qb(b);
+        HybridFrac r;
+        r._big = new_mpq();
+        r._den = 0;
+        op(r._big, qa.get(), qb.get());
+        r.demote_if_possible();
+        return r;
+    }
+
+    void
+    demote_if_possible() {
+        mpz_srcptr num = mpq_numref(_big);
+        mpz_srcptr den = mpq_denref(_big);
+        if (mpz_sizeinbase(num, 2) <= 63 && mpz_sizeinbase(den, 2) <= 63) {
+            // mpz_get_si is only defined for values fitting in a long.
+            static_assert(sizeof(long) == sizeof(ll),
+                          "HybridFrac assumes an LP64 platform");
+            ll n = mpz_get_si(num), d = mpz_get_si(den);
+            delete_mpq(_big);
+            _num = n;
+            _den = d;
+        }
+    }
+};
+
+#endif //CGAL_TUTORIAL_HYBRID_FRAC_H
@@ -0,0 +1,276 @@
+#ifndef CGAL_TUTORIAL_INCREMENTAL_HULL_H
+#define CGAL_TUTORIAL_INCREMENTAL_HULL_H
+
+#include <cstddef>
+#include <iterator>
+#include <set>
+
+// In part-v.cpp the hull is computed from a complete std::vector of points.
+// When points keep arriving, recomputing it from scratch for every new batch
+// repeats almost all of the work. IncrementalHull keeps the hull of the
+// points seen so far, and updates it point by point.
+//
+// As in the Graham-Andrew algorithm, the hull is split into a lower and an
+// upper chain, each kept in a std::set ordered by Less_xy_2 (a balanced
+// tree). A new point is found in each chain in O(log h): if it is inside or
+// on the chain nothing changes; otherwise it is inserted, and its
+// neighbours are removed for as long as they no longer turn strictly. Every
+// point is removed at most once, so an insertion costs O(log h) amortized.
+//
+// The hull is the same as that of CGAL::ch_graham_andrew() on all the points
+// inserted so far: vertices() runs counterclockwise from the
+// lexicographically smallest point, without duplicate or collinear points,
+// and iterates over the two trees directly rather than copying them. Only
+// Less_xy_2, Left_turn_2 and Equal_2 of the traits are used, so it works
+// with any of the traits classes of this tutorial.
+//
+// The structure is usually seeded with the output of CGAL::convex_hull_2()
+// for the points available at the start, and then fed the stream:
+//
+//    std::vector<Point_2> hull;
+//    CGAL::convex_hull_2(points.begin(), points.end(),
+//                        std::back_inserter(hull));
+//    IncrementalHull<Kernel> incremental(hull.begin(), hull.end());
+//    incremental.insert(p);
+//    for (const Point_2 &v : incremental.vertices()) { ... }
+
+template <typename Traits>
+class IncrementalHull {
+public:
+
+    using Point_2 = typename Traits::Point_2;
+
+private:
+
+    class Less {
+    public:
+        explicit Less(const Traits &traits)
+            : _less_xy{traits.less_xy_2_object()} {
+        }
+
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            return _less_xy(p, q);
+        }
+
+    private:
+        typename Traits::Less_xy_2 _less_xy;
+    };
+
+    using Chain = std::set<Point_2, Less>;
+
+public:
+
+    // The hull vertices, counterclockwise from the smallest point: the lower
+    // chain without its last point, then the upper chain backwards without
+    // its last point. A forward range over the two trees.
+    class Vertices {
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Point_2;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Point_2 *;
+            using reference = const Point_2 &;
+
+            iterator() = default;
+
+            reference
+            operator *() const {
+                return _in_lower ? *_lower : *_upper;
+            }
+
+            pointer
+            operator ->() const {
+                return &**this;
+            }
+
+            iterator &
+            operator ++() {
+                if (_in_lower) {
+                    if (++_lower == _lower_end) {
+                        _in_lower = false;
+                    }
+                } else {
+                    ++_upper;
+                }
+                return *this;
+            }
+
+            iterator
+            operator ++(int) {
+                iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            friend bool
+            operator ==(const iterator &a, const iterator &b) {
+                return a._in_lower == b._in_lower &&
+                       (a._in_lower ? a._lower == b._lower
+                                    : a._upper == b._upper);
+            }
+
+        private:
+            friend class Vertices;
+
+            using Lower = typename Chain::const_iterator;
+            using Upper = typename Chain::const_reverse_iterator;
+
+            iterator(Lower lower, Lower lower_end, Upper upper)
+                : _lower{lower}, _lower_end{lower_end}, _upper{upper},
+                  _in_lower{lower != lower_end} {
+            }
+
+            Lower _lower, _lower_end;
+            Upper _upper;
+            bool _in_lower = false;
+        };
+
+        [[nodiscard]] iterator
+        begin() const {
+            return {_hull->_lower.begin(), lower_end(), _hull->_upper.rbegin()};
+        }
+
+        [[nodiscard]] iterator
+        end() const {
+            return {lower_end(), lower_end(), upper_end()};
+        }
+
+        [[nodiscard]] std::size_t
+        size() const {
+            return _hull->size();
+        }
+
+    private:
+        friend class IncrementalHull;
+
+        explicit Vertices(const IncrementalHull &hull): _hull{&hull} {
+        }
+
+        // With a single point, the lower chain is all of the hull.
+        [[nodiscard]] typename Chain::const_iterator
+        lower_end() const {
+            const Chain &lower = _hull->_lower;
+            return lower.size() <= 1 ? lower.end() : std::prev(lower.end());
+        }
+
+        [[nodiscard]] typename Chain::const_reverse_iterator
+        upper_end() const {
+            const Chain &upper = _hull->_upper;
+            return upper.size() <= 1 ? upper.rbegin() : std::prev(upper.rend());
+        }
+
+        const IncrementalHull *_hull;
+    };
+
+    explicit IncrementalHull(const Traits &traits = Traits())
+        : _traits{traits}, _lower{Less(traits)}, _upper{Less(traits)} {
+    }
+
+    // Seeds the hull with the points in [first, last), typically the output
+    // of CGAL::convex_hull_2().
+    template <typename InputIterator>
+    IncrementalHull(InputIterator first, InputIterator last,
+                    const Traits &traits = Traits())
+        : IncrementalHull(traits) {
+        insert(first, last);
+    }
+
+    // Adds a point. Returns true if it is a vertex of the new hull.
+    bool
+    insert(const Point_2 &p) {
+        bool lower = insert_into<false>(_lower, p);
+        bool upper = insert_into<true>(_upper, p);
+        return lower || upper;
+    }
+
+    template <typename InputIterator>
+    void
+    insert(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    [[nodiscard]] Vertices
+    vertices() const {
+        return Vertices(*this);
+    }
+
+    // The number of hull vertices.
+    [[nodiscard]] std::size_t
+    size() const {
+        return _lower.size() <= 1 ? _lower.size()
+                                  : _lower.size() + _upper.size() - 2;
+    }
+
+    [[nodiscard]] bool
+    empty() const {
+        return _lower.empty();
+    }
+
+    // The two chains, both in Less_xy_2 order.
+    [[nodiscard]] const Chain &
+    lower() const {
+        return _lower;
+    }
+
+    [[nodiscard]] const Chain &
+    upper() const {
+        return _upper;
+    }
+
+private:
+
+    // Whether a, b, c turn the way the chain does: left for the lower
+    // chain, right for the upper chain (both are in Less_xy_2 order).
+    template <bool Upper>
+    bool
+    convex(const Point_2 &a, const Point_2 &b, const Point_2 &c) const {
+        auto left_turn = _traits.left_turn_2_object();
+        return Upper ? left_turn(c, b, a) : left_turn(a, b, c);
+    }
+
+    template <bool Upper>
+    bool
+    insert_into(Chain &chain, const Point_2 &p) {
+        auto next = chain.lower_bound(p);
+        if (next != chain.end() && _traits.equal_2_object()(*next, p)) {
+            return false;
+        }
+        // Between two chain points, p only belongs to the chain if it is
+        // strictly outside the segment between them.
+        if (next != chain.begin() && next != chain.end() &&
+            !convex<Upper>(*std::prev(next), p, *next)) {
+            return false;
+        }
+
+        auto it = chain.insert(next, p);
+        // Remove the points after p that no longer turn strictly...
+        for (auto after = std::next(it); after != chain.end();) {
+            auto after_next = std::next(after);
+            if (after_next == chain.end() ||
+                convex<Upper>(p, *after, *after_next)) {
+                break;
+            }
+            after = chain.erase(after);
+        }
+        // ... and those before it.
+        while (it != chain.begin()) {
+            auto before = std::prev(it);
+            if (before == chain.begin() ||
+                convex<Upper>(*std::prev(before), *before, p)) {
+                break;
+            }
+            chain.erase(before);
+        }
+        return true;
+    }
+
+    Traits _traits;
+    Chain _lower, _upper;
+};
+
+#endif //CGAL_TUTORIAL_INCREMENTAL_HULL_H
@@ -0,0 +1,189 @@
+#ifndef CGAL_TUTORIAL_INT_HULL_H
+#define CGAL_TUTORIAL_INT_HULL_H
+
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/convex_hull_2.h>
+#include <CGAL/number_utils.h>
+
+// Points on an integer grid are often loaded into the Point_2 of
+// CGAL::Exact_predicates_inexact_constructions_kernel, as in part-iv.cpp and
+// part-v.cpp. Every Left_turn_2 then computes the determinant in doubles,
+// checks it against an error bound, and would fall back to exact arithmetic
+// if the check failed, which for integers it never needs to.
+//
+// For coordinates that fit in 32 bits there is no need for any of that: the
+// differences of two coordinates fit in 33 bits, their products in 66, so the
+// determinant is exact in __int128, and Less_xy_2 is a plain comparison of
+// integers. IntTraits is a traits class for CGAL::ch_graham_andrew() over
+// such IntPoint2 points, and int_convex_hull_2() finds out whether the
+// points of a range of kernel points are all of this kind, and uses it if
+// they are.
+
+// A point with int32 coordinates.
+class IntPoint2 {
+public:
+
+    // The origin. A default constructor lets IntPoint2 live in a std::vector.
+    constexpr IntPoint2() = default;
+
+    constexpr IntPoint2(std::int32_t x, std::int32_t y) : _x(x), _y(y) {}
+
+    [[nodiscard]] constexpr std::int32_t
+    x() const {
+        return _x;
+    }
+
+    [[nodiscard]] constexpr std::int32_t
+    y() const {
+        return _y;
+    }
+
+    friend constexpr bool
+    operator==(const IntPoint2 &p, const IntPoint2 &q) = default;
+
+    friend std::ostream &
+    operator<<(std::ostream &out, const IntPoint2 &p) {
+        return out << p.x() << " " << p.y();
+    }
+
+private:
+    std::int32_t _x = 0;
+    std::int32_t _y = 0;
+};
+
+// The sign of the determinant of (p1 - p0, p2 - p0): positive for a left
+// turn, negative for a right turn, and zero if the points are collinear.
+// Exact for all int32 coordinates, without a filter.
+constexpr int
+orientation(const IntPoint2 &p0, const IntPoint2 &p1, const IntPoint2 &p2) {
+    const std::int64_t ux = std::int64_t(p1.x()) - p0.x();
+    const std::int64_t uy = std::int64_t(p1.y()) - p0.y();
+    const std::int64_t vx = std::int64_t(p2.x()) - p0.x();
+    const std::int64_t vy = std::int64_t(p2.y()) - p0.y();
+    const __int128 lhs = static_cast<__int128>(ux) * vy;
+    const __int128 rhs = static_cast<__int128>(uy) * vx;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+// A traits class for CGAL::ch_graham_andrew() over IntPoint2, in the manner
+// of FracTraits (see frac_traits.h).
+class IntTraits {
+public:
+
+    using Point_2 = IntPoint2;
+
+    class Less_xy_2 {
+    public:
+        constexpr bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            return p.x() < q.x() || (p.x() == q.x() && p.y() < q.y());
+        }
+    };
+
+    class Left_turn_2 {
+    public:
+        constexpr bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            return orientation(p0, p1, p2) > 0;
+        }
+    };
+
+    class Equal_2 {
+    public:
+        constexpr bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            return p == q;
+        }
+    };
+
+    [[nodiscard]] constexpr Less_xy_2
+    less_xy_2_object() const {
+        return {};
+    }
+
+    [[nodiscard]] constexpr Left_turn_2
+    left_turn_2_object() const {
+        return {};
+    }
+
+    [[nodiscard]] constexpr Equal_2
+    equal_2_object() const {
+        return {};
+    }
+};
+
+namespace int_hull_internal {
+
+    // Whether v is an integer that fits in an int32. The range is checked
+    // first, as converting a double out of range is undefined.
+    inline bool
+    is_int32(double v) {
+        return v >= -2147483648.0 && v <= 2147483647.0 &&
+               static_cast<double>(static_cast<std::int32_t>(v)) == v;
+    }
+
+}
+
+// Writes the hull of the kernel points [first, last) to result, as
+// CGAL::ch_graham_andrew() with traits would. If every coordinate is an
+// integer that fits in an int32, the points are copied to IntPoint2 and the
+// hull is computed with IntTraits; otherwise with traits. Both give the same
+// hull, starting from the same point, so the caller cannot tell which was
+// used, other than by the time it took.
+//
+// to_double() only approximates exact number types (1 + 2^-60 converts to
+// 1.0), so each converted coordinate is also compared with the original in
+// its own number type; a point is taken as integral only if both are equal.
+// The check stops at the first point that is not on the int32 grid, so input
+// that is not integral costs little more than the plain call.
+template <typename ForwardIterator, typename OutputIterator, typename Traits>
+OutputIterator
+int_convex_hull_2(ForwardIterator first, ForwardIterator last,
+                  OutputIterator result, const Traits &traits) {
+    using int_hull_internal::is_int32;
+    using Point = typename Traits::Point_2;
+    using FT = std::decay_t<decltype(first->x())>;
+
+    std::vector<IntPoint2> points;
+    points.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (ForwardIterator it = first; it != last; ++it) {
+        const double x = CGAL::to_double(it->x());
+        const double y = CGAL::to_double(it->y());
+        if (!is_int32(x) || !is_int32(y)) {
+            return CGAL::ch_graham_andrew(first, last, result, traits);
+        }
+        const auto xi = static_cast<std::int32_t>(x);
+        const auto yi = static_cast<std::int32_t>(y);
+        if (!(FT(xi) == it->x()) || !(FT(yi) == it->y())) {
+            return CGAL::ch_graham_andrew(first, last, result, traits);
+        }
+        points.emplace_back(xi, yi);
+    }
+
+    std::vector<IntPoint2> hull;
+    CGAL::ch_graham_andrew(points.begin(), points.end(),
+                           std::back_inserter(hull), IntTraits());
+    for (const IntPoint2 &p : hull) {
+        *result++ = Point(p.x(), p.y());
+    }
+    return result;
+}
+
+// As CGAL::convex_hull_2(), the traits default to the kernel of the points.
+template <typename ForwardIterator, typename OutputIterator>
+OutputIterator
+int_convex_hull_2(ForwardIterator first, ForwardIterator last,
+                  OutputIterator result) {
+    using Point = typename std::iterator_traits<ForwardIterator>::value_type;
+    using Kernel = typename CGAL::Kernel_traits<Point>::Kernel;
+    return int_convex_hull_2(first, last, result, Kernel());
+}
+
+#endif //CGAL_TUTORIAL_INT_HULL_H
@@ -0,0 +1,167 @@
+// Computes the hull of a raw binary point file with mapped_convex_hull_2()
+// (see mapped_hull.h), prints it, and reports how fast the file was read and
+// how much memory stayed resident. The points are double[2] records, or
+// float[2] records with "float".
+//
+// usage: mapped-hull FILE [double|float] [chunk_points]
+//        mapped-hull --write FILE N_POINTS [double|float]
+//
+// The second form writes N_POINTS random points in the unit disk to FILE,
+// for trying out the first.
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include "bench_util.h"
+#include "mapped_hull.h"
+#include "point_generators.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+
+void
+usage() {
+    std::cerr << "usage: mapped-hull FILE [double|float] [chunk_points]\n"
+                 "       mapped-hull --write FILE N_POINTS [double|float]"
+              << std::endl;
+}
+
+// Reads text as a positive integer into value. Unlike arg_or(), rejects
+// anything else, as a chunk size of 0 or a negative count would be wrapped
+// into a size_t.
+bool
+parse_positive(const char *text, std::size_t &value) {
+    char *end = nullptr;
+    errno = 0;
+    const long long v = std::strtoll(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE || v <= 0) {
+        return false;
+    }
+    value = static_cast<std::size_t>(v);
+    return true;
+}
+
+// Reads "double" or "float" into single, which is true for "float", and
+// rejects anything else.
+bool
+parse_type(const std::string &text, bool &single) {
+    if (text != "double" && text != "float") {
+        return false;
+    }
+    single = text == "float";
+    return true;
+}
+
+template <typename Coordinate>
+void
+write_points(const std::string &path, std::size_t n) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("mapped-hull: cannot open " + path);
+    }
+    const std::size_t batch = std::size_t(1) << 20;
+    for (std::size_t i = 0; i < n; i += batch) {
+        std::vector<Coordinate> xy;
+        auto points = random_points<Point_2>(Distribution::uniform_disk,
+                                             std::min(batch, n - i),
+                                             [](double x, double y) {
+                                                 return Point_2(x, y);
+                                             }, 42 + i);
+        for (const Point_2 &p : points) {
+            xy.push_back(static_cast<Coordinate>(p.x()));
+            xy.push_back(static_cast<Coordinate>(p.y()));
+        }
+        out.write(reinterpret_cast<const char *>(xy.data()),
+                  static_cast<std::streamsize>(xy.size() * sizeof(Coordinate)));
+    }
+    if (!out) {
+        throw std::runtime_error("mapped-hull: cannot write " + path);
+    }
+}
+
+template <typename Coordinate>
+void
+hull(const std::string &path, std::size_t chunk_size) {
+    MappedFile file(path);
+    std::vector<Point_2> hull;
+    double t = time_seconds([&] {
+        mapped_convex_hull_2<Coordinate>(file, std::back_inserter(hull),
+                                         Kernel(), chunk_size);
+    });
+
+    for (const Point_2 &p : hull) {
+        std::cout << p << std::endl;
+    }
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    std::cerr << file.size() / (2 * sizeof(Coordinate)) << " points, "
+              << hull.size() << " hull points, " << t << " s, "
+              << file.size() / t * 1e-9 << " GB/s, peak resident "
+              << usage.ru_maxrss / 1024 << " MB" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    if (argc < 2) {
+        usage();
+        return 1;
+    }
+
+    if (std::string(argv[1]) == "--write") {
+        if (argc < 4) {
+            std::cerr << "mapped-hull --write: FILE and N_POINTS expected"
+                      << std::endl;
+            return 1;
+        }
+        std::size_t n = 0;
+        bool single = false;
+        if (!parse_positive(argv[3], n) ||
+            (argc > 4 && !parse_type(argv[4], single))) {
+            usage();
+            return 1;
+        }
+        try {
+            if (single) {
+                write_points<float>(argv[2], n);
+            } else {
+                write_points<double>(argv[2], n);
+            }
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    bool single = false;
+    std::size_t chunk_size = std::size_t(1) << 20;
+    if ((argc > 2 && !parse_type(argv[2], single)) ||
+        (argc > 3 && !parse_positive(argv[3], chunk_size))) {
+        usage();
+        return 1;
+    }
+    try {
+        if (single) {
+            hull<float>(argv[1], chunk_size);
+        } else {
+            hull<double>(argv[1], chunk_size);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,159 @@
+#ifndef CGAL_TUTORIAL_MAPPED_HULL_H
+#define CGAL_TUTORIAL_MAPPED_HULL_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "hull_prefilter.h"
+
+// The hulls so far are computed from ranges that are in memory. A point file
+// of hundreds of gigabytes is not, but its hull does not need it to be: the
+// hull of the hulls of any partition of the points is the hull of all of
+// them. mapped_convex_hull_2() therefore reads a raw binary file of
+// (x, y) records through a memory mapping, one chunk of points at a time,
+// and computes the hull of each chunk together with the hull of everything
+// before it. Only a chunk and a hull are kept, whatever the size of the file.
+// Each chunk goes through the Akl_toussaint_prefilter of hull_prefilter.h
+// first: the octagon of the hull so far soon covers almost all of the points,
+// so most chunks cost two linear passes rather than a sort. Only
+// Less_xy_2, Left_turn_2 and Equal_2 of the traits are used.
+//
+// MappedFile maps the whole file read-only and tells the kernel with
+// madvise(MADV_SEQUENTIAL) that it will be read front to back, so that it
+// reads ahead and evicts behind. After each chunk we also drop its pages
+// from our mapping with MADV_DONTNEED, which keeps the resident set at about
+// one chunk even where the page cache is large.
+//
+//    MappedFile file("points.bin");
+//    mapped_convex_hull_2<double>(file, std::back_inserter(hull), Kernel());
+//
+// The records are two native-endian doubles or two floats, without a header.
+// Errors from the system calls are thrown as std::system_error, and a file
+// whose size is not a multiple of the record size as std::runtime_error.
+
+// A read-only memory mapping of a whole file.
+class MappedFile {
+public:
+
+    explicit MappedFile(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "MappedFile: cannot open " + path);
+        }
+        struct stat status{};
+        if (::fstat(fd, &status) < 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(),
+                                    "MappedFile: cannot stat " + path);
+        }
+        _size = static_cast<std::size_t>(status.st_size);
+        if (_size > 0) {
+            void *data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(),
+                                        "MappedFile: cannot map " + path);
+            }
+            _data = static_cast<const char *>(data);
+            ::madvise(data, _size, MADV_SEQUENTIAL);
+        }
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &
+    operator =(const MappedFile &) = delete;
+
+    ~MappedFile() {
+        if (_data) {
+            ::munmap(const_cast<char *>(_data), _size);
+        }
+    }
+
+    [[nodiscard]] const char *
+    data() const {
+        return _data;
+    }
+
+    [[nodiscard]] std::size_t
+    size() const {
+        return _size;
+    }
+
+    // Drops the pages entirely within bytes [first, last) from the mapping;
+    // reading them again faults them back in from the file.
+    void
+    release(std::size_t first, std::size_t last) const {
+        const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        first = (first + page - 1) / page * page;
+        last = std::min(last, _size) / page * page;
+        if (first < last) {
+            ::madvise(const_cast<char *>(_data) + first, last - first,
+                      MADV_DONTNEED);
+        }
+    }
+
+private:
+    const char *_data = nullptr;
+    std::size_t _size = 0;
+};
+
+// Writes the hull of the points of a file of Coordinate[2] records (double
+// or float) to result, as CGAL::ch_graham_andrew() does, reading chunk_size
+// points at a time. The points are Traits::Point_2(x, y). Throws
+// std::invalid_argument if chunk_size is 0.
+template <typename Coordinate, typename OutputIterator, typename Traits>
+OutputIterator
+mapped_convex_hull_2(const MappedFile &file, OutputIterator result,
+                     const Traits &traits,
+                     std::size_t chunk_size = std::size_t(1) << 20) {
+    using Point_2 = typename Traits::Point_2;
+    constexpr std::size_t record = 2 * sizeof(Coordinate);
+    if (chunk_size == 0) {
+        throw std::invalid_argument(
+            "mapped_convex_hull_2: chunk_size must be positive");
+    }
+    if (file.size() % record != 0) {
+        throw std::runtime_error(
+            "mapped_convex_hull_2: the file size is not a multiple of the "
+            "record size");
+    }
+    const std::size_t n = file.size() / record;
+    const auto *xy = reinterpret_cast<const Coordinate *>(file.data());
+
+    // The hull so far, followed by the points of the current chunk.
+    std::vector<Point_2> hull, points;
+    points.reserve(chunk_size + 1024);
+    for (std::size_t first = 0; first < n; first += chunk_size) {
+        const std::size_t last = std::min(n, first + chunk_size);
+        points.assign(hull.begin(), hull.end());
+        for (std::size_t i = first; i < last; ++i) {
+            points.emplace_back(xy[2 * i], xy[2 * i + 1]);
+        }
+        Akl_toussaint_prefilter()(points, traits);
+        hull.clear();
+        CGAL::ch_graham_andrew(points.begin(), points.end(),
+                               std::back_inserter(hull), traits);
+        file.release(first * record, last * record);
+    }
+    return std::copy(hull.begin(), hull.end(), result);
+}
+
+#endif //CGAL_TUTORIAL_MAPPED_HULL_H
@@ -0,0 +1,201 @@
+// Computes the 3D hull of the points of an OFF, STL or PLY file with
+// parallel_convex_hull_3() (see parallel_hull_3.h) into a CGAL::Surface_mesh,
+// writes it to OUT if given, and reports its size and how long it took.
+//
+// With --bench, does so for every OFF, STL and PLY file in a directory,
+// meshes/ by default: the hull of each is computed with CGAL::convex_hull_3()
+// and with parallel_convex_hull_3() on 1, 2, 4, ... threads, and the times
+// are reported per file and in total. Every parallel hull is checked to have
+// the same vertices as that of CGAL::convex_hull_3().
+//
+// usage: parallel-hull-3 FILE [OUT]
+//        parallel-hull-3 --bench [DIRECTORY]
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/convex_hull_3.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include "bench_util.h"
+#include "parallel_hull_3.h"
+
+#ifndef CGAL_TUTORIAL_MESHES_DIR
+#define CGAL_TUTORIAL_MESHES_DIR "meshes"
+#endif
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+
+// Reads the points of a polygon soup: the vertices of the file, whether or
+// not its faces make a valid mesh.
+bool
+read_points(const std::string &path, std::vector<Point_3> &points) {
+    std::vector<std::vector<std::size_t>> polygons;
+    return CGAL::IO::read_polygon_soup(path, points, polygons);
+}
+
+// The points of the vertices of mesh, sorted, to compare hulls by.
+std::vector<Point_3>
+sorted_vertices(const Mesh &mesh) {
+    std::vector<Point_3> vertices(mesh.points().begin(),
+                                  mesh.points().end());
+    std::sort(vertices.begin(), vertices.end());
+    return vertices;
+}
+
+int
+hull(const std::string &path, const std::string &out) {
+    std::vector<Point_3> points;
+    if (!read_points(path, points)) {
+        std::cerr << "parallel-hull-3: cannot read " << path << std::endl;
+        return 1;
+    }
+    Mesh mesh;
+    double t = time_seconds([&] {
+        parallel_convex_hull_3(points.begin(), points.end(), mesh);
+    });
+    std::cout << points.size() << " points, hull of "
+              << mesh.number_of_vertices() << " vertices and "
+              << mesh.number_of_faces() << " faces, " << t << " s"
+              << std::endl;
+    if (!out.empty() && !CGAL::IO::write_polygon_mesh(out, mesh)) {
+        std::cerr << "parallel-hull-3: cannot write " << out << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int
+bench(const std::filesystem::path &directory) {
+#ifdef CGAL_LINKED_WITH_TBB
+    const unsigned max_threads =
+        std::max(1u, std::thread::hardware_concurrency());
+#else
+    const unsigned max_threads = 1;
+#endif
+    std::vector<unsigned> thread_counts;
+    for (unsigned threads = 1;; threads = std::min(2 * threads, max_threads)) {
+        thread_counts.push_back(threads);
+        if (threads == max_threads) {
+            break;
+        }
+    }
+
+    std::vector<std::filesystem::path> paths;
+    for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+        const auto extension = entry.path().extension();
+        if (entry.is_regular_file() && (extension == ".off" ||
+                                        extension == ".stl" ||
+                                        extension == ".ply")) {
+            paths.push_back(entry.path());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::cout << "times in ms" << std::endl;
+    std::cout << "mesh\tpoints\thull\tconvex_hull_3";
+    for (unsigned threads : thread_counts) {
+        std::cout << "\t" << threads
+                  << (threads == 1 ? " thread" : " threads");
+    }
+    std::cout << std::endl;
+
+    double sequential_total = 0.0;
+    std::vector<double> parallel_total(thread_counts.size(), 0.0);
+    std::vector<std::string> skipped, differ;
+    for (const auto &path : paths) {
+        std::vector<Point_3> points;
+        if (!read_points(path.string(), points) || points.size() < 4) {
+            skipped.push_back(path.filename().string());
+            continue;
+        }
+
+        Mesh expected;
+        double sequential_t = best_seconds(3, [&] {
+            expected.clear();
+            CGAL::convex_hull_3(points.begin(), points.end(), expected);
+        });
+        sequential_total += sequential_t;
+        std::cout << path.filename().string() << "\t" << points.size()
+                  << "\t" << expected.number_of_vertices() << "\t"
+                  << sequential_t * 1e3;
+
+        const auto expected_vertices = sorted_vertices(expected);
+        bool same = true;
+        for (std::size_t i = 0; i < thread_counts.size(); ++i) {
+#ifdef CGAL_LINKED_WITH_TBB
+            tbb::global_control control(
+                tbb::global_control::max_allowed_parallelism,
+                thread_counts[i]);
+#endif
+            Mesh mesh;
+            double t = best_seconds(3, [&] {
+                mesh.clear();
+                parallel_convex_hull_3(points.begin(), points.end(), mesh);
+            });
+            parallel_total[i] += t;
+            same = same && sorted_vertices(mesh) == expected_vertices;
+            std::cout << "\t" << t * 1e3;
+        }
+        std::cout << std::endl;
+        if (!same) {
+            differ.push_back(path.filename().string());
+        }
+    }
+
+    std::cout << "total\t\t\t" << sequential_total * 1e3;
+    for (double t : parallel_total) {
+        std::cout << "\t" << t * 1e3;
+    }
+    std::cout << std::endl << "speedup over convex_hull_3\t\t\t";
+    for (double t : parallel_total) {
+        std::cout << "\t" << sequential_total / t << "x";
+    }
+    std::cout << std::endl;
+    if (!skipped.empty()) {
+        std::cout << "skipped " << skipped.size() << ":";
+        for (const auto &name : skipped) {
+            std::cout << " " << name;
+        }
+        std::cout << std::endl;
+    }
+    if (differ.empty()) {
+        std::cout << "hulls identical" << std::endl;
+        return 0;
+    }
+    std::cout << "hulls DIFFER for " << differ.size() << ":";
+    for (const auto &name : differ) {
+        std::cout << " " << name;
+    }
+    std::cout << std::endl;
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+
+    if (argc < 2) {
+        std::cerr << "usage: parallel-hull-3 FILE [OUT]\n"
+                     "       parallel-hull-3 --bench [DIRECTORY]"
+                  << std::endl;
+        return 1;
+    }
+
+    if (std::string(argv[1]) == "--bench") {
+        return bench(argc > 2 ? argv[2] : CGAL_TUTORIAL_MESHES_DIR);
+    }
+    return hull(argv[1], argc > 2 ? argv[2] : "");
+
+}
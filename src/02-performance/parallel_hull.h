@@ -0,0 +1,88 @@
+#ifndef CGAL_TUTORIAL_PARALLEL_HULL_H
+#define CGAL_TUTORIAL_PARALLEL_HULL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <CGAL/Kernel_traits.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+#endif
+
+#include "hull_chains.h"
+
+// CGAL::convex_hull_2() in part-iv.cpp and part-v.cpp runs on one thread.
+// parallel_convex_hull_2() takes the same arguments and computes the same
+// hull, divide-and-conquer style on TBB's work-stealing scheduler:
+//    1. the points are sorted with Less_xy_2 by tbb::parallel_sort(),
+//    2. the sorted points are cut into runs, and the hull of each run is
+//       computed as two monotone chains (see hull_chains.h) by whichever
+//       thread picks the run up,
+//    3. the chains of neighbouring runs are joined by finding the two
+//       bridges between them, as the runs finish.
+// The runs are separated, so joining their hulls only needs the tangents,
+// and tbb::parallel_reduce() joins them in order. Every decision is made by
+// the traits' predicates, which are exact in the EPICK kernel, so the result
+// is exactly that of CGAL::convex_hull_2(): the vertices of the hull
+// counterclockwise from the lexicographically smallest one.
+//
+// Without TBB (CGAL_LINKED_WITH_TBB is defined by linking with
+// CGAL::TBB_support) the same steps run on one thread.
+
+namespace parallel_hull_internal {
+
+    // Runs shorter than this are not split any further; below it the
+    // scheduling overhead outweighs the work.
+    constexpr std::size_t grain_size = 1 << 14;
+
+}
+
+template <typename InputIterator, typename OutputIterator, typename Traits>
+OutputIterator
+parallel_convex_hull_2(InputIterator first, InputIterator last,
+                       OutputIterator result, const Traits &traits) {
+    using Point_2 = typename Traits::Point_2;
+    using Chains = HullChains<Point_2>;
+
+    std::vector<Point_2> points(first, last);
+    const auto less_xy = traits.less_xy_2_object();
+
+#ifdef CGAL_LINKED_WITH_TBB
+    tbb::parallel_sort(points.begin(), points.end(), less_xy);
+    Chains chains = tbb::parallel_reduce(
+        tbb::blocked_range<std::size_t>(0, points.size(),
+                                        parallel_hull_internal::grain_size),
+        Chains(),
+        [&](const tbb::blocked_range<std::size_t> &run, Chains left) {
+            return join(left,
+                        hull_chains(points.begin() + run.begin(),
+                                    points.begin() + run.end(), traits),
+                        traits);
+        },
+        [&](const Chains &left, const Chains &right) {
+            return join(left, right, traits);
+        });
+#else
+    std::sort(points.begin(), points.end(), less_xy);
+    Chains chains = hull_chains(points.begin(), points.end(), traits);
+#endif
+
+    return write_hull(chains, result, traits);
+}
+
+// As CGAL::convex_hull_2(), the traits default to the kernel of the points.
+template <typename InputIterator, typename OutputIterator>
+OutputIterator
+parallel_convex_hull_2(InputIterator first, InputIterator last,
+                       OutputIterator result) {
+    using Point_2 = typename std::iterator_traits<InputIterator>::value_type;
+    using Kernel = typename CGAL::Kernel_traits<Point_2>::Kernel;
+    return parallel_convex_hull_2(first, last, result, Kernel());
+}
+
+#endif //CGAL_TUTORIAL_PARALLEL_HULL_H
@@ -0,0 +1,80 @@
+#ifndef CGAL_TUTORIAL_PARALLEL_HULL_3_H
+#define CGAL_TUTORIAL_PARALLEL_HULL_3_H
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/extreme_points_3.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
+// CGAL::convex_hull_3() runs on one thread. parallel_convex_hull_3() takes
+// the same arguments and computes the same hull, partition-and-merge style:
+//    1. the points are cut into runs, and the vertices of the hull of each
+//       run are found by CGAL::extreme_points_3() on whichever thread picks
+//       the run up,
+//    2. neighbouring runs are merged, as they finish, by finding the
+//       vertices of the hull of the union of their vertices,
+//    3. the hull of the vertices that are left is built into the polygon
+//       mesh by CGAL::convex_hull_3().
+// Every vertex of the hull of all the points is a vertex of the hull of
+// whichever run it is in, so nothing that is needed is thrown away. For CAD
+// parts and scanned meshes most points are far inside, step 1 is almost all
+// of the work, and tbb::parallel_reduce() spreads it over the threads.
+//
+// Without TBB (CGAL_LINKED_WITH_TBB is defined by linking with
+// CGAL::TBB_support) this is CGAL::convex_hull_3().
+
+namespace parallel_hull_3_internal {
+
+    // Runs shorter than this are not split any further.
+    constexpr std::size_t grain_size = 1 << 14;
+
+    // The vertices of the hull of points.
+    template <typename Point_3>
+    std::vector<Point_3>
+    extreme_points(const std::vector<Point_3> &points) {
+        std::vector<Point_3> vertices;
+        CGAL::extreme_points_3(points, std::back_inserter(vertices));
+        return vertices;
+    }
+
+}
+
+// Builds the hull of the points [first, last) into mesh, as
+// CGAL::convex_hull_3(first, last, mesh) would.
+template <typename RandomAccessIterator, typename PolygonMesh>
+void
+parallel_convex_hull_3(RandomAccessIterator first, RandomAccessIterator last,
+                       PolygonMesh &mesh) {
+#ifdef CGAL_LINKED_WITH_TBB
+    using namespace parallel_hull_3_internal;
+    using Point_3 =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using Points = std::vector<Point_3>;
+
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    Points vertices = tbb::parallel_reduce(
+        tbb::blocked_range<std::size_t>(0, n, grain_size),
+        Points(),
+        [&](const tbb::blocked_range<std::size_t> &run, Points partial) {
+            partial.insert(partial.end(), first + run.begin(),
+                           first + run.end());
+            return extreme_points(partial);
+        },
+        [](Points a, const Points &b) {
+            a.insert(a.end(), b.begin(), b.end());
+            return extreme_points(a);
+        });
+    CGAL::convex_hull_3(vertices.begin(), vertices.end(), mesh);
+#else
+    CGAL::convex_hull_3(first, last, mesh);
+#endif
+}
+
+#endif //CGAL_TUTORIAL_PARALLEL_HULL_3_H
@@ -0,0 +1,125 @@
+#ifndef CGAL_TUTORIAL_POINT_GENERATORS_H
+#define CGAL_TUTORIAL_POINT_GENERATORS_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+// The point distributions the hull benchmarks are run on. They differ in how
+// many of the points end up on the hull:
+//    * uniform_disk   - uniform in the unit disk, O(n^(1/3)) hull points,
+//    * uniform_square - uniform in [-1, 1]^2, O(log n) hull points,
+//    * gaussian       - standard normal in x and y, O(sqrt(log n)) hull
+//                       points, but with a few far outliers,
+//    * on_circle      - on the unit circle (up to rounding), where almost
+//                       every point is on the hull,
+//    * clustered      - in 16 small normal clusters around random centres in
+//                       the unit disk, so the hull is made of the outer
+//                       clusters and most points are in dense clumps.
+enum class Distribution {
+    uniform_disk,
+    uniform_square,
+    gaussian,
+    on_circle,
+    clustered
+};
+
+inline constexpr Distribution all_distributions[] = {
+    Distribution::uniform_disk, Distribution::uniform_square,
+    Distribution::gaussian, Distribution::on_circle, Distribution::clustered
+};
+
+inline std::string
+distribution_name(Distribution distribution) {
+    switch (distribution) {
+        case Distribution::uniform_disk:
+            return "uniform disk";
+        case Distribution::uniform_square:
+            return "uniform square";
+        case Distribution::gaussian:
+            return "gaussian";
+        case Distribution::on_circle:
+            return "on circle";
+        case Distribution::clustered:
+            return "clustered";
+    }
+    return "";
+}
+
+// Creates n random points from the distribution, as make_point(x, y) for
+// double coordinates x and y.
+template <typename Point, typename MakePoint>
+std::vector<Point>
+random_points(Distribution distribution, std::size_t n, MakePoint make_point,
+              std::uint64_t seed = 42) {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::normal_distribution<double> normal;
+    std::uniform_real_distribution<double> angle(0.0, 2.0 * std::numbers::pi);
+
+    // The cluster centres are only drawn for clustered, so that the other
+    // distributions get the same points as before.
+    constexpr std::size_t n_clusters = 16;
+    std::array<std::array<double, 2>, n_clusters> centres{};
+    std::uniform_int_distribution<std::size_t> cluster(0, n_clusters - 1);
+    if (distribution == Distribution::clustered) {
+        for (auto &centre : centres) {
+            do {
+                centre = {uniform(gen), uniform(gen)};
+            } while (centre[0] * centre[0] + centre[1] * centre[1] > 1.0);
+        }
+    }
+
+    std::vector<Point> points;
+    points.reserve(n);
+    while (points.size() < n) {
+        double x = 0.0, y = 0.0;
+        switch (distribution) {
+            case Distribution::uniform_disk:
+                x = uniform(gen);
+                y = uniform(gen);
+                if (x * x + y * y > 1.0) {
+                    continue;
+                }
+                break;
+            case Distribution::uniform_square:
+                x = uniform(gen);
+                y = uniform(gen);
+                break;
+            case Distribution::gaussian:
+                x = normal(gen);
+                y = normal(gen);
+                break;
+            case Distribution::on_circle: {
+                double t = angle(gen);
+                x = std::cos(t);
+                y = std::sin(t);
+                break;
+            }
+            case Distribution::clustered: {
+                const auto &centre = centres[cluster(gen)];
+                x = centre[0] + 0.02 * normal(gen);
+                y = centre[1] + 0.02 * normal(gen);
+                break;
+            }
+        }
+        points.push_back(make_point(x, y));
+    }
+    return points;
+}
+
+// The same, with Point(x, y).
+template <typename Point>
+std::vector<Point>
+random_points(Distribution distribution, std::size_t n) {
+    return random_points<Point>(distribution, n, [](double x, double y) {
+        return Point(x, y);
+    });
+}
+
+#endif //CGAL_TUTORIAL_POINT_GENERATORS_H
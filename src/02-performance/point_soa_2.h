@@ -0,0 +1,479 @@
+#ifndef CGAL_TUTORIAL_POINT_SOA_2_H
+#define CGAL_TUTORIAL_POINT_SOA_2_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+#include <CGAL/enum.h>
+#include <CGAL/number_utils.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// The examples keep their points as an array of structs, a Point_2 points[]
+// or a std::vector<Point_2>, so every x coordinate sits next to its y
+// coordinate. A sweep that tests all the points against the same line reads
+// them in pairs, and the compiler cannot load four x coordinates into one
+// vector register. PointSoA2 keeps the coordinates of a double kernel such
+// as CGAL::Exact_predicates_inexact_constructions_kernel as a structure of
+// arrays instead: all the x coordinates in one 64-byte aligned array, all the
+// y coordinates in another.
+//
+// PointSoA2_traits is a ConvexHullTraits_2 class whose Point_2 is the index
+// of a point in the container, so the CGAL hull functions run on the indices
+// without building a single Point_2:
+//
+//    PointSoA2<Kernel> soa(points.begin(), points.end());
+//    std::vector<std::size_t> indices(soa.size());
+//    std::iota(indices.begin(), indices.end(), 0);
+//    CGAL::convex_hull_2(indices.begin(), indices.end(),
+//                        std::back_inserter(hull), soa.traits());
+//
+// The comparisons compare the doubles directly. Left_turn_2 and Orientation_2
+// evaluate the determinant in double and only ask the kernel when it is too
+// close to zero for its sign to be certain; the remaining predicates, which
+// the hull algorithms call rarely, are the kernel's. The hulls are those of
+// the kernel. Sorting indices is slower than sorting the points themselves,
+// though: every comparison gathers four coordinates from two arrays, where a
+// std::vector<Point_2> has them side by side.
+//
+// soa_convex_hull_2() consumes the container directly: it runs the
+// Akl-Toussaint throw-away step of hull_prefilter.h as one sweep over the two
+// arrays, which is where the layout pays off, and then the Graham-Andrew
+// algorithm on the indices of the points that are left. When the compiler
+// targets AVX2 the sweep tests four points at a time with AVX2 instructions;
+// otherwise it is a plain loop without branches that the compiler may
+// vectorize itself.
+
+namespace point_soa_2_internal {
+
+    // Allocates storage aligned to a cache line.
+    template <typename T, std::size_t Alignment = 64>
+    class Aligned_allocator {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = Aligned_allocator<U, Alignment>;
+        };
+
+        Aligned_allocator() = default;
+
+        template <typename U>
+        Aligned_allocator(const Aligned_allocator<U, Alignment> &) {
+        }
+
+        T *
+        allocate(std::size_t n) {
+            return static_cast<T *>(::operator new(
+                n * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void
+        deallocate(T *p, std::size_t) {
+            ::operator delete(p, std::align_val_t{Alignment});
+        }
+
+        friend bool
+        operator ==(const Aligned_allocator &, const Aligned_allocator &) {
+            return true;
+        }
+    };
+
+    // The sign of (b - a) x (c - a) if the double evaluation is certain of
+    // it, and 2 otherwise. The error bound is Shewchuk's for orient2d.
+    inline int
+    filtered_orientation(double ax, double ay, double bx, double by,
+                         double cx, double cy) {
+        const double l = (bx - ax) * (cy - ay);
+        const double r = (by - ay) * (cx - ax);
+        const double det = l - r;
+        const double bound = 3.3306690738754716e-16 * (std::abs(l) +
+                                                       std::abs(r));
+        if (det > bound) {
+            return 1;
+        }
+        if (det < -bound) {
+            return -1;
+        }
+        return 2;
+    }
+
+    // The edges of a convex polygon, as a point and a direction each.
+    struct Edges {
+        int n = 0;
+        double ax[8], ay[8], dx[8], dy[8];
+    };
+
+    // Classifies the points i in [first, last) against the edges: 1 if the
+    // double orientations put them strictly left of every edge by more than
+    // tolerance, 0 if they are strictly right of some edge by more than
+    // tolerance, and 2 if the exact predicate has to decide.
+    inline void
+    classify(const double *xs, const double *ys, std::size_t first,
+             std::size_t last, const Edges &edges, double tolerance,
+             std::uint8_t *result) {
+        std::size_t i = first;
+#if defined(__AVX2__)
+        const __m256d plus = _mm256_set1_pd(tolerance);
+        const __m256d minus = _mm256_set1_pd(-tolerance);
+        for (; i + 4 <= last; i += 4) {
+            const __m256d x = _mm256_loadu_pd(xs + i);
+            const __m256d y = _mm256_loadu_pd(ys + i);
+            __m256d inside = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+            __m256d outside = _mm256_setzero_pd();
+            for (int k = 0; k < edges.n; ++k) {
+                const __m256d dx = _mm256_set1_pd(edges.dx[k]);
+                const __m256d dy = _mm256_set1_pd(edges.dy[k]);
+                const __m256d ax = _mm256_set1_pd(edges.ax[k]);
+                const __m256d ay = _mm256_set1_pd(edges.ay[k]);
+                const __m256d o = _mm256_sub_pd(
+                    _mm256_mul_pd(dx, _mm256_sub_pd(y, ay)),
+                    _mm256_mul_pd(dy, _mm256_sub_pd(x, ax)));
+                inside = _mm256_and_pd(inside,
+                                       _mm256_cmp_pd(o, plus, _CMP_GT_OQ));
+                outside = _mm256_or_pd(outside,
+                                       _mm256_cmp_pd(o, minus, _CMP_LT_OQ));
+            }
+            const int in = _mm256_movemask_pd(inside);
+            const int out = _mm256_movemask_pd(outside);
+            for (int j = 0; j < 4; ++j) {
+                result[i + j] = (in >> j & 1) ? 1 : (out >> j & 1) ? 0 : 2;
+            }
+        }
+#endif
+        for (; i < last; ++i) {
+            bool inside = true, outside = false;
+            for (int k = 0; k < edges.n; ++k) {
+                const double o = edges.dx[k] * (ys[i] - edges.ay[k]) -
+                                 edges.dy[k] * (xs[i] - edges.ax[k]);
+                inside = inside & (o > tolerance);
+                outside = outside | (o < -tolerance);
+            }
+            result[i] = inside ? 1 : outside ? 0 : 2;
+        }
+    }
+
+}
+
+template <typename Kernel>
+class PointSoA2_traits;
+
+// The points of a double kernel as two aligned coordinate arrays.
+template <typename Kernel>
+class PointSoA2 {
+public:
+
+    using Point_2 = typename Kernel::Point_2;
+    using Coordinates =
+        std::vector<double, point_soa_2_internal::Aligned_allocator<double>>;
+
+    PointSoA2() = default;
+
+    template <typename InputIterator>
+    PointSoA2(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    void
+    push_back(double x, double y) {
+        _x.push_back(x);
+        _y.push_back(y);
+    }
+
+    void
+    push_back(const Point_2 &p) {
+        push_back(CGAL::to_double(p.x()), CGAL::to_double(p.y()));
+    }
+
+    void
+    reserve(std::size_t n) {
+        _x.reserve(n);
+        _y.reserve(n);
+    }
+
+    [[nodiscard]] std::size_t
+    size() const {
+        return _x.size();
+    }
+
+    [[nodiscard]] bool
+    empty() const {
+        return _x.empty();
+    }
+
+    [[nodiscard]] double
+    x(std::size_t i) const {
+        return _x[i];
+    }
+
+    [[nodiscard]] double
+    y(std::size_t i) const {
+        return _y[i];
+    }
+
+    [[nodiscard]] const double *
+    xs() const {
+        return _x.data();
+    }
+
+    [[nodiscard]] const double *
+    ys() const {
+        return _y.data();
+    }
+
+    // Builds the kernel point of index i, e.g. for the output.
+    [[nodiscard]] Point_2
+    point(std::size_t i) const {
+        return Point_2(_x[i], _y[i]);
+    }
+
+    [[nodiscard]] PointSoA2_traits<Kernel>
+    traits() const {
+        return PointSoA2_traits<Kernel>(*this);
+    }
+
+private:
+    Coordinates _x, _y;
+};
+
+template <typename Kernel>
+class PointSoA2_traits {
+public:
+
+    using Point_2 = std::size_t;
+
+    explicit PointSoA2_traits(const PointSoA2<Kernel> &points)
+        : _points{&points} {
+    }
+
+    class Equal_2 {
+    public:
+        bool
+        operator()(Point_2 p, Point_2 q) const {
+            return _s->x(p) == _s->x(q) && _s->y(p) == _s->y(q);
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    class Less_xy_2 {
+    public:
+        bool
+        operator()(Point_2 p, Point_2 q) const {
+            const double px = _s->x(p), qx = _s->x(q);
+            return px < qx || (px == qx && _s->y(p) < _s->y(q));
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    class Less_yx_2 {
+    public:
+        bool
+        operator()(Point_2 p, Point_2 q) const {
+            const double py = _s->y(p), qy = _s->y(q);
+            return py < qy || (py == qy && _s->x(p) < _s->x(q));
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    class Orientation_2 {
+    public:
+        CGAL::Orientation
+        operator()(Point_2 p, Point_2 q, Point_2 r) const {
+            const int sign = point_soa_2_internal::filtered_orientation(
+                _s->x(p), _s->y(p), _s->x(q), _s->y(q), _s->x(r), _s->y(r));
+            if (sign == 1) {
+                return CGAL::LEFT_TURN;
+            }
+            if (sign == -1) {
+                return CGAL::RIGHT_TURN;
+            }
+            return Kernel().orientation_2_object()(
+                _s->point(p), _s->point(q), _s->point(r));
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    class Left_turn_2 {
+    public:
+        bool
+        operator()(Point_2 p, Point_2 q, Point_2 r) const {
+            const int sign = point_soa_2_internal::filtered_orientation(
+                _s->x(p), _s->y(p), _s->x(q), _s->y(q), _s->x(r), _s->y(r));
+            if (sign != 2) {
+                return sign == 1;
+            }
+            return Kernel().left_turn_2_object()(
+                _s->point(p), _s->point(q), _s->point(r));
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    class Less_signed_distance_to_line_2 {
+    public:
+        bool
+        operator()(Point_2 p, Point_2 q, Point_2 r, Point_2 s) const {
+            return Kernel().less_signed_distance_to_line_2_object()(
+                _s->point(p), _s->point(q), _s->point(r), _s->point(s));
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    class Less_rotate_ccw_2 {
+    public:
+        bool
+        operator()(Point_2 e, Point_2 p, Point_2 q) const {
+            return Kernel().less_rotate_ccw_2_object()(
+                _s->point(e), _s->point(p), _s->point(q));
+        }
+
+        const PointSoA2<Kernel> *_s;
+    };
+
+    [[nodiscard]] Equal_2
+    equal_2_object() const {
+        return {_points};
+    }
+
+    [[nodiscard]] Less_xy_2
+    less_xy_2_object() const {
+        return {_points};
+    }
+
+    [[nodiscard]] Less_yx_2
+    less_yx_2_object() const {
+        return {_points};
+    }
+
+    [[nodiscard]] Orientation_2
+    orientation_2_object() const {
+        return {_points};
+    }
+
+    [[nodiscard]] Left_turn_2
+    left_turn_2_object() const {
+        return {_points};
+    }
+
+    [[nodiscard]] Less_signed_distance_to_line_2
+    less_signed_distance_to_line_2_object() const {
+        return {_points};
+    }
+
+    [[nodiscard]] Less_rotate_ccw_2
+    less_rotate_ccw_2_object() const {
+        return {_points};
+    }
+
+private:
+    const PointSoA2<Kernel> *_points;
+};
+
+// Writes the indices of the hull vertices of points to result, as
+// CGAL::ch_graham_andrew() would with PointSoA2_traits: counterclockwise from
+// the lexicographically smallest point.
+template <typename Kernel, typename OutputIterator>
+OutputIterator
+soa_convex_hull_2(const PointSoA2<Kernel> &points, OutputIterator result) {
+    using namespace point_soa_2_internal;
+    const std::size_t n = points.size();
+    const PointSoA2_traits<Kernel> traits = points.traits();
+    const double *xs = points.xs(), *ys = points.ys();
+
+    std::vector<std::size_t> candidates;
+    if (n < 16) {
+        candidates.resize(n);
+        std::iota(candidates.begin(), candidates.end(), std::size_t(0));
+        return CGAL::ch_graham_andrew(candidates.begin(), candidates.end(),
+                                      result, traits);
+    }
+
+    // The extremes in the eight directions of hull_prefilter.h, and the
+    // largest coordinate, with selects rather than branches.
+    std::array<double, 8> best;
+    best.fill(-std::numeric_limits<double>::infinity());
+    std::array<std::size_t, 8> extreme{};
+    double max_abs = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double x = xs[i], y = ys[i];
+        const std::array<double, 8> score = {
+            -x, -(x + y), -y, x - y, x, x + y, y, -(x - y)
+        };
+        for (int k = 0; k < 8; ++k) {
+            const bool better = score[k] > best[k];
+            best[k] = better ? score[k] : best[k];
+            extreme[k] = better ? i : extreme[k];
+        }
+        max_abs = std::max(max_abs, std::max(std::abs(x), std::abs(y)));
+    }
+
+    auto equal = traits.equal_2_object();
+    std::array<std::size_t, 8> vertex;
+    int n_vertices = 0;
+    for (int k = 0; k < 8; ++k) {
+        if (n_vertices == 0 || !equal(vertex[n_vertices - 1], extreme[k])) {
+            vertex[n_vertices++] = extreme[k];
+        }
+    }
+    while (n_vertices > 1 && equal(vertex[n_vertices - 1], vertex[0])) {
+        --n_vertices;
+    }
+
+    // With all the extremes on a line, no point is inside their hull.
+    if (n_vertices < 3) {
+        candidates.resize(n);
+        std::iota(candidates.begin(), candidates.end(), std::size_t(0));
+        return CGAL::ch_graham_andrew(candidates.begin(), candidates.end(),
+                                      result, traits);
+    }
+
+    Edges edges;
+    edges.n = n_vertices;
+    for (int k = 0; k < n_vertices; ++k) {
+        const std::size_t a = vertex[k], b = vertex[(k + 1) % n_vertices];
+        edges.ax[k] = xs[a];
+        edges.ay[k] = ys[a];
+        edges.dx[k] = xs[b] - xs[a];
+        edges.dy[k] = ys[b] - ys[a];
+    }
+    // The coordinates are exact, so an orientation of the sweep is off by
+    // less than 2^-48 (2 max|coordinate|)^2; we allow 2^-45 of it.
+    const double tolerance = std::ldexp(4.0 * max_abs * max_abs, -45);
+
+    std::vector<std::uint8_t> inside(n);
+    classify(xs, ys, 0, n, edges, tolerance, inside.data());
+
+    // The points the sweep could not decide go to the exact predicate.
+    auto left_turn = traits.left_turn_2_object();
+    for (std::size_t i = 0; i < n; ++i) {
+        bool keep = inside[i] == 0;
+        for (int k = 0; inside[i] == 2 && k < n_vertices && !keep; ++k) {
+            keep = !left_turn(vertex[k], vertex[(k + 1) % n_vertices], i);
+        }
+        if (keep) {
+            candidates.push_back(i);
+        }
+    }
+    return CGAL::ch_graham_andrew(candidates.begin(), candidates.end(),
+                                  result, traits);
+}
+
+#endif //CGAL_TUTORIAL_POINT_SOA_2_H
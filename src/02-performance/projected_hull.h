@@ -0,0 +1,105 @@
+#ifndef CGAL_TUTORIAL_PROJECTED_HULL_H
+#define CGAL_TUTORIAL_PROJECTED_HULL_H
+
+#include <utility>
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
+
+#include <CGAL/boost/graph/properties.h>
+#include <CGAL/convex_hull_2.h>
+
+// part-vi.cpp computes the hull of 3D points projected on to the yz-plane with
+// Projection_traits_yz_3, whose Point_2 is the Point_3 of the kernel. The
+// points there are a std::vector written by hand; for the vertices of a mesh
+// we would have to copy them out of the mesh first, only for the hull
+// algorithm to read them once more.
+//
+// There is no need for the copy. vertex_points() gives an iterator range over
+// the points of the vertices of any VertexListGraph (a CGAL::Surface_mesh, a
+// CGAL::Polyhedron_3, ...) through its vertex point map: a
+// boost::transform_iterator over vertices(graph) that dereferences to
+// get(map, v). For Surface_mesh that is a reference into the point property
+// of the mesh, so nothing is copied. As the Point_2 of the projection traits
+// is the Point_3 of the mesh, the range can be handed to CGAL::convex_hull_2()
+// directly:
+//
+//    CGAL::Surface_mesh<K::Point_3> mesh;
+//    CGAL::IO::read_polygon_mesh("meshes/armadillo.off", mesh);
+//    std::vector<K::Point_3> silhouette;
+//    projected_convex_hull_2(mesh, std::back_inserter(silhouette),
+//                            CGAL::Projection_traits_yz_3<K>());
+//
+// CGAL::convex_hull_2() runs ch_akl_toussaint(), which works on forward
+// iterators: it finds the extreme points in one pass over the range and
+// only copies the points outside of the octagon they span.
+
+namespace projected_hull_internal {
+
+    // Maps a vertex to its point, by reference if the map hands out
+    // references.
+    template <typename VertexPointMap>
+    class Vertex_to_point {
+    public:
+
+        using Reference =
+            typename boost::property_traits<VertexPointMap>::reference;
+
+        // transform_iterator has to be default constructible.
+        Vertex_to_point() = default;
+
+        explicit Vertex_to_point(VertexPointMap map) : _map(map) {}
+
+        template <typename Vertex>
+        Reference
+        operator()(const Vertex &v) const {
+            return get(_map, v);
+        }
+
+    private:
+        VertexPointMap _map;
+    };
+
+}
+
+// An iterator over the points of the vertices of a Graph.
+template <typename Graph, typename VertexPointMap>
+using Vertex_point_iterator = boost::transform_iterator<
+    projected_hull_internal::Vertex_to_point<VertexPointMap>,
+    typename boost::graph_traits<Graph>::vertex_iterator>;
+
+// The points of the vertices of graph, through map, as a pair of iterators.
+template <typename Graph, typename VertexPointMap>
+std::pair<Vertex_point_iterator<Graph, VertexPointMap>,
+          Vertex_point_iterator<Graph, VertexPointMap>>
+vertex_points(const Graph &graph, VertexPointMap map) {
+    projected_hull_internal::Vertex_to_point<VertexPointMap> to_point(map);
+    auto range = vertices(graph);
+    return {boost::make_transform_iterator(range.begin(), to_point),
+            boost::make_transform_iterator(range.end(), to_point)};
+}
+
+// Writes the hull of the points of the vertices of graph, through map, to
+// result. The traits project the points, so their Point_2 has to be the
+// value type of map, as for the Projection_traits_xy_3, _yz_3 and _xz_3 of
+// the kernel of the points, or Projection_traits_3 for any direction.
+template <typename Graph, typename VertexPointMap, typename OutputIterator,
+          typename Traits>
+OutputIterator
+projected_convex_hull_2(const Graph &graph, VertexPointMap map,
+                        OutputIterator result, const Traits &traits) {
+    auto [first, last] = vertex_points(graph, map);
+    return CGAL::convex_hull_2(first, last, result, traits);
+}
+
+// The same through the vertex point map of the graph.
+template <typename Graph, typename OutputIterator, typename Traits>
+OutputIterator
+projected_convex_hull_2(const Graph &graph, OutputIterator result,
+                        const Traits &traits) {
+    return projected_convex_hull_2(graph, get(CGAL::vertex_point, graph),
+                                   result, traits);
+}
+
+#endif //CGAL_TUTORIAL_PROJECTED_HULL_H
@@ -0,0 +1,337 @@
+#ifndef CGAL_TUTORIAL_SILHOUETTES_H
+#define CGAL_TUTORIAL_SILHOUETTES_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/Projection_traits_3.h>
+#include <CGAL/convex_hull_2.h>
+#include <CGAL/number_utils.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
+// part-vi.cpp projects 3D points on to the yz-plane with
+// Projection_traits_yz_3. For the silhouettes of a part seen from K
+// directions we could call CGAL::convex_hull_2() K times, with the
+// Projection_traits_3 of each direction, but every call reads all the points
+// again, and each runs its own throw-away pass over them.
+//
+// silhouettes_2() computes the K hulls together, in three steps:
+//    1. One pass over the points finds, for every direction, the extreme
+//       points of the projection in the eight directions of the
+//       Akl-Toussaint octagon (see hull_prefilter.h). Each point is loaded
+//       once and projected on to all K planes while it is in registers.
+//    2. A second pass keeps, for every direction, the points that are not
+//       strictly inside its octagon.
+//    3. The hull of each direction is computed from the points it kept, by
+//       CGAL::convex_hull_2() with the exact Projection_traits_3.
+// With TBB the two passes are split over the threads by blocks of points,
+// and the hulls of step 3 by direction.
+//
+// The projections of steps 1 and 2 are in doubles, on to an orthonormal
+// basis of the plane computed in doubles. Their errors are below
+// 2^-45 max|coordinate|^2 in an orientation, and we only discard points that
+// are inside every edge of the octagon by more than 2^-36 of it. Points near
+// an edge are kept, so the hulls are exactly those of convex_hull_2() with
+// the same traits. Only where several points have the same projection may a
+// different one of them stand for it, as it may for convex_hull_2() on the
+// same points in another order.
+//
+// The points must be random access, as a std::vector<Point_3> or the
+// points() of a CGAL::Surface_mesh without removed vertices.
+
+namespace silhouettes_internal {
+
+    // Blocks of points smaller than this are not split any further.
+    constexpr std::size_t grain_size = 1 << 13;
+
+    // Fewer points than this are passed to the hulls unfiltered.
+    constexpr std::size_t min_filtered = 16;
+
+    using Vector = std::array<double, 3>;
+
+    inline double
+    dot(const Vector &a, const Vector &b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    inline Vector
+    cross(const Vector &a, const Vector &b) {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+                a[0] * b[1] - a[1] * b[0]};
+    }
+
+    inline Vector
+    normalized(const Vector &a) {
+        const double length = std::sqrt(dot(a, a));
+        return {a[0] / length, a[1] / length, a[2] / length};
+    }
+
+    // An orthonormal basis (u, v) of the plane perpendicular to a normal n,
+    // with u x v = n / |n|, so that a left turn in (u, v) coordinates is a
+    // left turn of the Projection_traits_3 for n.
+    struct Basis {
+        Vector u;
+        Vector v;
+    };
+
+    inline Basis
+    basis(const Vector &normal) {
+        const Vector n = normalized(normal);
+        // The axis least parallel to n.
+        Vector axis{0.0, 0.0, 0.0};
+        int k = 0;
+        for (int i = 1; i < 3; ++i) {
+            if (std::abs(n[i]) < std::abs(n[k])) {
+                k = i;
+            }
+        }
+        axis[k] = 1.0;
+        const Vector u = normalized(cross(n, axis));
+        return {u, cross(n, u)};
+    }
+
+    // The best scores and the points with them, per direction, in the
+    // order of hull_prefilter.h: the smallest x, x + y and y, the largest
+    // x - y, x, x + y and y, and the smallest x - y. And the largest
+    // absolute value of a coordinate of any point.
+    struct Extremes {
+        std::vector<std::array<double, 8>> best;
+        std::vector<std::array<std::size_t, 8>> index;
+        double max_abs = 0.0;
+
+        explicit Extremes(std::size_t n_directions = 0)
+            : best(n_directions), index(n_directions) {
+            for (auto &b : best) {
+                b.fill(-std::numeric_limits<double>::infinity());
+            }
+        }
+
+        void
+        join(const Extremes &other) {
+            max_abs = std::max(max_abs, other.max_abs);
+            for (std::size_t d = 0; d < best.size(); ++d) {
+                for (int k = 0; k < 8; ++k) {
+                    if (other.best[d][k] > best[d][k]) {
+                        best[d][k] = other.best[d][k];
+                        index[d][k] = other.index[d][k];
+                    }
+                }
+            }
+        }
+    };
+
+    template <typename Point>
+    Vector
+    approximate(const Point &p) {
+        return {CGAL::to_double(p.x()), CGAL::to_double(p.y()),
+                CGAL::to_double(p.z())};
+    }
+
+    // Step 1 over the points [first, last) of points.
+    template <typename Iterator>
+    void
+    find_extremes(Iterator points, std::size_t first, std::size_t last,
+                  const std::vector<Basis> &bases, Extremes &extremes) {
+        for (std::size_t i = first; i < last; ++i) {
+            const Vector p = approximate(points[i]);
+            extremes.max_abs = std::max({extremes.max_abs, std::abs(p[0]),
+                                         std::abs(p[1]), std::abs(p[2])});
+            for (std::size_t d = 0; d < bases.size(); ++d) {
+                const double x = dot(bases[d].u, p), y = dot(bases[d].v, p);
+                const std::array<double, 8> score = {
+                    -x, -(x + y), -y, x - y, x, x + y, y, -(x - y)
+                };
+                auto &best = extremes.best[d];
+                auto &index = extremes.index[d];
+                for (int k = 0; k < 8; ++k) {
+                    const bool better = score[k] > best[k];
+                    best[k] = better ? score[k] : best[k];
+                    index[k] = better ? i : index[k];
+                }
+            }
+        }
+    }
+
+    // The octagon of one direction, as its distinct vertices in
+    // counterclockwise order, projected. Fewer than 3 vertices mean that
+    // nothing is discarded.
+    struct Octagon {
+        std::array<std::array<double, 2>, 8> vertex;
+        int size = 0;
+    };
+
+    // Step 2 over the points [first, last) of points: appends those that
+    // are not certainly inside the octagon of direction d to kept[d].
+    template <typename Iterator>
+    void
+    keep_outside(Iterator points, std::size_t first, std::size_t last,
+                 const std::vector<Basis> &bases,
+                 const std::vector<Octagon> &octagons, double tolerance,
+                 std::vector<std::vector<std::size_t>> &kept) {
+        for (std::size_t i = first; i < last; ++i) {
+            const Vector p = approximate(points[i]);
+            for (std::size_t d = 0; d < bases.size(); ++d) {
+                const Octagon &octagon = octagons[d];
+                const double x = dot(bases[d].u, p), y = dot(bases[d].v, p);
+                bool inside = octagon.size >= 3;
+                for (int k = 0; inside && k < octagon.size; ++k) {
+                    const auto &a = octagon.vertex[k];
+                    const auto &b = octagon.vertex[(k + 1) % octagon.size];
+                    inside = (b[0] - a[0]) * (y - a[1]) -
+                             (b[1] - a[1]) * (x - a[0]) > tolerance;
+                }
+                if (!inside) {
+                    kept[d].push_back(i);
+                }
+            }
+        }
+    }
+
+}
+
+// Writes the hull of the points [first, last) projected along each of the
+// normals to silhouettes, one vector per normal, as CGAL::convex_hull_2()
+// with CGAL::Projection_traits_3 for the normal would. The normals must not
+// be zero. The axis planes of Projection_traits_xy_3, _yz_3 and _xz_3 are
+// seen along (0, 0, 1), (1, 0, 0) and (0, -1, 0).
+template <typename RandomAccessIterator, typename Vector_3>
+void
+silhouettes_2(RandomAccessIterator first, RandomAccessIterator last,
+              const std::vector<Vector_3> &normals,
+              std::vector<std::vector<
+                  typename std::iterator_traits<RandomAccessIterator>::
+                      value_type>> &silhouettes) {
+    using namespace silhouettes_internal;
+    using Point_3 =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using Kernel = typename CGAL::Kernel_traits<Point_3>::Kernel;
+    using Traits = CGAL::Projection_traits_3<Kernel>;
+
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    const std::size_t n_directions = normals.size();
+    std::vector<Basis> bases;
+    for (const Vector_3 &normal : normals) {
+        const Vector a = {CGAL::to_double(normal.x()),
+                          CGAL::to_double(normal.y()),
+                          CGAL::to_double(normal.z())};
+        if (dot(a, a) == 0.0) {
+            throw std::invalid_argument("silhouettes_2: zero normal");
+        }
+        bases.push_back(basis(a));
+    }
+    silhouettes.assign(n_directions, {});
+
+    // Step 1.
+    Extremes extremes(n_directions);
+    if (n >= min_filtered) {
+#ifdef CGAL_LINKED_WITH_TBB
+        extremes = tbb::parallel_reduce(
+            tbb::blocked_range<std::size_t>(0, n, grain_size),
+            Extremes(n_directions),
+            [&](const tbb::blocked_range<std::size_t> &range,
+                Extremes partial) {
+                find_extremes(first, range.begin(), range.end(), bases,
+                              partial);
+                return partial;
+            },
+            [](Extremes a, const Extremes &b) {
+                a.join(b);
+                return a;
+            });
+#else
+        find_extremes(first, 0, n, bases, extremes);
+#endif
+    }
+
+    std::vector<Octagon> octagons(n_directions);
+    for (std::size_t d = 0; d < n_directions && n >= min_filtered; ++d) {
+        Octagon &octagon = octagons[d];
+        for (int k = 0; k < 8; ++k) {
+            const Vector p = approximate(first[extremes.index[d][k]]);
+            const std::array<double, 2> v = {dot(bases[d].u, p),
+                                             dot(bases[d].v, p)};
+            if (octagon.size == 0 || octagon.vertex[octagon.size - 1] != v) {
+                octagon.vertex[octagon.size++] = v;
+            }
+        }
+        while (octagon.size > 1 &&
+               octagon.vertex[octagon.size - 1] == octagon.vertex[0]) {
+            --octagon.size;
+        }
+    }
+    const double tolerance =
+        std::ldexp(extremes.max_abs * extremes.max_abs, -36);
+
+    // Step 2.
+    using Kept = std::vector<std::vector<std::size_t>>;
+    std::vector<Kept> kept_per_thread;
+#ifdef CGAL_LINKED_WITH_TBB
+    tbb::enumerable_thread_specific<Kept> kept{Kept(n_directions)};
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, n, grain_size),
+        [&](const tbb::blocked_range<std::size_t> &range) {
+            keep_outside(first, range.begin(), range.end(), bases, octagons,
+                         tolerance, kept.local());
+        });
+    for (auto &local : kept) {
+        kept_per_thread.push_back(std::move(local));
+    }
+#else
+    kept_per_thread.emplace_back(n_directions);
+    keep_outside(first, 0, n, bases, octagons, tolerance,
+                 kept_per_thread.back());
+#endif
+
+    // Step 3.
+    auto hull = [&](std::size_t d) {
+        std::vector<Point_3> points;
+        for (const auto &kept : kept_per_thread) {
+            for (std::size_t i : kept[d]) {
+                points.push_back(first[i]);
+            }
+        }
+        const Traits traits(normals[d]);
+        CGAL::convex_hull_2(points.begin(), points.end(),
+                            std::back_inserter(silhouettes[d]), traits);
+    };
+#ifdef CGAL_LINKED_WITH_TBB
+    tbb::parallel_for(std::size_t(0), n_directions, hull);
+#else
+    for (std::size_t d = 0; d < n_directions; ++d) {
+        hull(d);
+    }
+#endif
+}
+
+// The 26 directions from the centre of a cube to its faces, edges and
+// corners, (a, b, c) with a, b, c in {-1, 0, 1}, not all zero.
+template <typename Vector_3>
+std::vector<Vector_3>
+cube_view_directions() {
+    std::vector<Vector_3> directions;
+    for (int a = -1; a <= 1; ++a) {
+        for (int b = -1; b <= 1; ++b) {
+            for (int c = -1; c <= 1; ++c) {
+                if (a != 0 || b != 0 || c != 0) {
+                    directions.emplace_back(a, b, c);
+                }
+            }
+        }
+    }
+    return directions;
+}
+
+#endif //CGAL_TUTORIAL_SILHOUETTES_H
@@ -0,0 +1,118 @@
+// A small shape library whose hulls are computed at compile time with
+// static_ch_graham_andrew() (see static_hull.h) and stored as static tables.
+// At run time we only print them, check them against CGAL::ch_graham_andrew(),
+// and compare the cost of computing them again with the cost of reading the
+// tables, which is zero.
+//
+// usage: static-hulls [n_repetitions]
+
+#include <array>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <CGAL/convex_hull_2.h>
+
+#include "bench_util.h"
+#include "static_hull.h"
+
+namespace shapes {
+
+    // The five-point stencil of the discrete Laplacian.
+    constexpr std::array<FracPoint2, 5> five_point = {{
+        {0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}
+    }};
+
+    // The nine-point stencil: a 3 x 3 block, whose edges are full of
+    // collinear points.
+    constexpr std::array<FracPoint2, 9> nine_point = {{
+        {-1, -1}, {0, -1}, {1, -1},
+        {-1, 0}, {0, 0}, {1, 0},
+        {-1, 1}, {0, 1}, {1, 1}
+    }};
+
+    // A hexagonal neighbourhood with its centre, given in rational
+    // coordinates, with one of the points listed twice.
+    constexpr std::array<FracPoint2, 8> hexagon = {{
+        {0, 0}, {1, 0}, {Frac(1, 2), Frac(7, 8)}, {Frac(-1, 2), Frac(7, 8)},
+        {-1, 0}, {Frac(-1, 2), Frac(-7, 8)}, {Frac(1, 2), Frac(-7, 8)},
+        {1, 0}
+    }};
+
+    // Rational points on the unit circle (from the Pythagorean triples
+    // 3-4-5 and 5-12-13), together with a few points inside.
+    constexpr std::array<FracPoint2, 24> disk = {{
+        {1, 0}, {0, 1}, {-1, 0}, {0, -1},
+        {Frac(3, 5), Frac(4, 5)}, {Frac(-3, 5), Frac(4, 5)},
+        {Frac(3, 5), Frac(-4, 5)}, {Frac(-3, 5), Frac(-4, 5)},
+        {Frac(4, 5), Frac(3, 5)}, {Frac(-4, 5), Frac(3, 5)},
+        {Frac(4, 5), Frac(-3, 5)}, {Frac(-4, 5), Frac(-3, 5)},
+        {Frac(5, 13), Frac(12, 13)}, {Frac(-5, 13), Frac(12, 13)},
+        {Frac(5, 13), Frac(-12, 13)}, {Frac(-5, 13), Frac(-12, 13)},
+        {Frac(12, 13), Frac(5, 13)}, {Frac(-12, 13), Frac(5, 13)},
+        {Frac(12, 13), Frac(-5, 13)}, {Frac(-12, 13), Frac(-5, 13)},
+        {0, 0}, {Frac(1, 2), Frac(1, 2)}, {0.25, -0.5}, {-0.7, 0.1}
+    }};
+
+    // The hull tables. These are computed by the compiler: the program only
+    // contains the results.
+    constexpr auto five_point_hull = static_ch_graham_andrew(five_point);
+    constexpr auto nine_point_hull = static_ch_graham_andrew(nine_point);
+    constexpr auto hexagon_hull = static_ch_graham_andrew(hexagon);
+    constexpr auto disk_hull = static_ch_graham_andrew(disk);
+
+    static_assert(five_point_hull.size() == 4);
+    static_assert(nine_point_hull.size() == 4);
+    static_assert(hexagon_hull.size() == 6);
+    static_assert(disk_hull.size() == 20);
+
+    // The hulls start at the lexicographically smallest point.
+    static_assert(nine_point_hull[0].x() == -1 && nine_point_hull[0].y() == -1);
+    static_assert(disk_hull[0].x() == -1 && disk_hull[0].y() == 0);
+
+}
+
+template <std::size_t M, std::size_t N>
+void
+check(const std::string &name, const std::array<FracPoint2, M> &points,
+      const StaticHull<FracPoint2, N> &table, std::size_t n_repetitions) {
+    std::vector<FracPoint2> hull;
+    double t = time_seconds([&] {
+        for (std::size_t i = 0; i < n_repetitions; ++i) {
+            hull.clear();
+            CGAL::ch_graham_andrew(points.begin(), points.end(),
+                                   std::back_inserter(hull), FracTraits());
+        }
+    });
+
+    bool same = hull.size() == table.size();
+    auto equal = FracTraits().equal_2_object();
+    for (std::size_t i = 0; same && i < hull.size(); ++i) {
+        same = equal(hull[i], table[i]);
+    }
+
+    std::cout << name << ": " << table.size() << " hull points, "
+              << (same ? "identical to" : "DIFFERENT from")
+              << " CGAL::ch_graham_andrew()" << std::endl;
+    std::cout << "  ";
+    for (const FracPoint2 &p : table) {
+        std::cout << p << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "  computing it at run time: " << t / n_repetitions * 1e9
+              << " ns per hull" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    auto n = static_cast<std::size_t>(arg_or(argc, argv, 1, 100'000));
+
+    check("five-point stencil", shapes::five_point, shapes::five_point_hull, n);
+    check("nine-point stencil", shapes::nine_point, shapes::nine_point_hull, n);
+    check("hexagon", shapes::hexagon, shapes::hexagon_hull, n);
+    check("rational disk", shapes::disk, shapes::disk_hull, n);
+
+    return 0;
+
+}
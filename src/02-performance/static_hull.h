@@ -0,0 +1,118 @@
+#ifndef CGAL_TUTORIAL_STATIC_HULL_H
+#define CGAL_TUTORIAL_STATIC_HULL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "frac_traits.h"
+
+// Many point sets are known when the program is compiled: stencils, template
+// shapes, the outlines in a shape library. Their hulls do not have to be
+// computed when the program starts. Since Frac, FracPoint2 and FracTraits are
+// constexpr, a small Graham-Andrew implementation that is constexpr too lets
+// the compiler compute the hull and put it into the executable as a table:
+//
+//    constexpr std::array<FracPoint2, 5> cross = {...};
+//    constexpr auto cross_hull = static_ch_graham_andrew(cross);
+//    static_assert(cross_hull.size() == 4);
+//
+// The result is the same as that of CGAL::ch_graham_andrew() with the same
+// traits: it starts at the lexicographically smallest point, runs
+// counterclockwise, and contains no duplicate or collinear points. Anything
+// that fails while the hull is computed (e.g. a Frac overflow) is a compile
+// time error.
+
+// The hull of at most N points: a fixed-size array of which the first size()
+// entries are used.
+template <typename Point, std::size_t N>
+class StaticHull {
+public:
+
+    [[nodiscard]] constexpr std::size_t
+    size() const {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr const Point &
+    operator [](std::size_t i) const {
+        return _points[i];
+    }
+
+    [[nodiscard]] constexpr const Point *
+    begin() const {
+        return _points.data();
+    }
+
+    [[nodiscard]] constexpr const Point *
+    end() const {
+        return _points.data() + _size;
+    }
+
+    constexpr void
+    push_back(const Point &p) {
+        _points[_size++] = p;
+    }
+
+    constexpr void
+    pop_back() {
+        --_size;
+    }
+
+private:
+    std::array<Point, N> _points{};
+    std::size_t _size = 0;
+};
+
+// Andrew's monotone chain, as in CGAL::ch_graham_andrew(): sort the points
+// lexicographically, then build the lower hull from left to right and the
+// upper hull from right to left, popping every point that does not make a
+// left turn. The points are taken by value since we sort them.
+template <typename Traits = FracTraits, typename Point, std::size_t N>
+[[nodiscard]] constexpr StaticHull<Point, N>
+static_ch_graham_andrew(std::array<Point, N> points,
+                        const Traits &traits = Traits()) {
+    auto less_xy = traits.less_xy_2_object();
+    auto left_turn = traits.left_turn_2_object();
+    auto equal = traits.equal_2_object();
+
+    std::sort(points.begin(), points.end(), less_xy);
+    const auto n = static_cast<std::size_t>(
+        std::unique(points.begin(), points.end(), equal) - points.begin());
+
+    StaticHull<Point, N> hull;
+    if (n < 3) {
+        for (std::size_t i = 0; i < n; ++i) {
+            hull.push_back(points[i]);
+        }
+        return hull;
+    }
+
+    // The chains together hold one point more than the hull, since the upper
+    // chain ends where the lower one started.
+    StaticHull<Point, N + 1> chain;
+    for (std::size_t i = 0; i < n; ++i) {
+        while (chain.size() >= 2 &&
+               !left_turn(chain[chain.size() - 2], chain[chain.size() - 1],
+                          points[i])) {
+            chain.pop_back();
+        }
+        chain.push_back(points[i]);
+    }
+    const std::size_t lower_size = chain.size();
+    for (std::size_t i = n - 1; i-- > 0;) {
+        while (chain.size() > lower_size &&
+               !left_turn(chain[chain.size() - 2], chain[chain.size() - 1],
+                          points[i])) {
+            chain.pop_back();
+        }
+        chain.push_back(points[i]);
+    }
+
+    for (std::size_t i = 0; i + 1 < chain.size(); ++i) {
+        hull.push_back(chain[i]);
+    }
+    return hull;
+}
+
+#endif //CGAL_TUTORIAL_STATIC_HULL_H
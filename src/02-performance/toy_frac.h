@@ -0,0 +1,213 @@
+#ifndef CGAL_TUTORIAL_TOY_FRAC_H
+#define CGAL_TUTORIAL_TOY_FRAC_H
+
+#include <numeric>
+#include <ostream>
+
+// A copy of the toy Frac, FracPoint2 and Traits classes from
+// 01-first-steps/part-vii.cpp (see there for the explanations). The benchmarks
+// in this directory use it as the baseline that the production versions are
+// measured against, so it should be kept identical to the tutorial code.
+namespace toy {
+
+using ll = long long;
+
+class Frac {
+public:
+    Frac(): _num{0}, _den{1} {
+    }
+
+    explicit
+    Frac(ll num): _num{num}, _den{1} {
+    }
+
+    Frac(ll num, ll den): _num{num}, _den{den} {
+    }
+
+    bool
+    operator <(const Frac &other) const {
+        return num() * other.den() < other.num() * den();
+    }
+
+    bool
+    operator <=(const Frac &other) const {
+        return num() * other.den() <= other.num() * den();
+    }
+
+    bool
+    operator >(const Frac &other) const {
+        return num() * other.den() > other.num() * den();
+    }
+
+    bool
+    operator >=(const Frac &other) const {
+        return num() * other.den() >= other.num() * den();
+    }
+
+    bool
+    operator ==(const Frac &other) const {
+        return num() * other.den() == other.num() * den();
+    }
+
+    [[nodiscard]] Frac
+    operator +(const Frac &other) const {
+        ll new_num = num() * other.den() + den() * other.num();
+        ll new_den = den() * other.den();
+        ll new_gcd = std::gcd(new_num, new_den);
+        if (new_gcd != 0) {
+            new_num /= new_gcd;
+            new_den /= new_gcd;
+        }
+        return {new_num, new_den};
+    }
+
+    [[nodiscard]] Frac
+    operator -(const Frac &other) const {
+        ll new_num = num() * other.den() - den() * other.num();
+        ll new_den = den() * other.den();
+        ll new_gcd = std::gcd(new_num, new_den);
+        if (new_gcd != 0) {
+            new_num /= new_gcd;
+            new_den /= new_gcd;
+        }
+        return {new_num, new_den};
+    }
+
+    [[nodiscard]] Frac
+    operator *(const Frac &other) const {
+        ll new_num = num() * other.num();
+        ll new_den = den() * other.den();
+        ll new_gcd = std::gcd(new_num, new_den);
+        if (new_gcd != 0) {
+            new_num /= new_gcd;
+            new_den /= new_gcd;
+        }
+        return {new_num, new_den};
+    }
+
+    [[nodiscard]] Frac
+    operator /(const Frac &other) const {
+        ll new_num = num() * other.den();
+        ll new_den = den() * other.num();
+        ll new_gcd = std::gcd(new_num, new_den);
+        if (new_gcd != 0) {
+            new_num /= new_gcd;
+            new_den /= new_gcd;
+        }
+        return {new_num, new_den};
+    }
+
+    [[nodiscard]] bool
+    positive() const {
+        return (_num > 0 && _den > 0) || (_num < 0 && _den < 0);
+    }
+
+    [[nodiscard]] ll
+    num() const { return _num; }
+
+    [[nodiscard]] ll
+    den() const { return _den; }
+
+private:
+    ll _num;
+    ll _den;
+};
+
+inline std::ostream &operator<<(std::ostream &out, const Frac &f) {
+    out << f.num() << "/" << f.den();
+    return out;
+}
+
+class FracPoint2 {
+public:
+    FracPoint2(Frac x, Frac y) : _x{x}, _y{y} {
+    }
+
+    [[nodiscard]] const Frac &
+    x() const {
+        return _x;
+    }
+
+    [[nodiscard]] const Frac &
+    y() const {
+        return _y;
+    }
+
+private:
+    Frac _x, _y;
+};
+
+inline std::ostream &operator <<(std::ostream &out, const FracPoint2 &p) {
+    out << "<" << p.x() << ", " << p.y() << ">";
+    return out;
+}
+
+[[nodiscard]] inline FracPoint2
+operator +(const FracPoint2 &p, const FracPoint2 &q) {
+    return {p.x() + q.x(), p.y() + q.y()};
+}
+
+[[nodiscard]] inline FracPoint2
+operator -(const FracPoint2 &p, const FracPoint2 &q) {
+    return {p.x() - q.x(), p.y() - q.y()};
+}
+
+[[nodiscard]] inline Frac
+cross(const FracPoint2 &p, const FracPoint2 &q) {
+    return p.x() * q.y() - q.x() * p.y();
+}
+
+class Traits {
+public:
+    using Point_2 = FracPoint2;
+
+    class Less_xy_2 {
+    public:
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            return p.x() < q.x() || (p.x() == q.x() && p.y() < q.y());
+        }
+    };
+
+    class Left_turn_2 {
+    public:
+        bool
+        operator()(const Point_2 &p0, const Point_2 &p1,
+                   const Point_2 &p2) const {
+            Frac tv = cross(p1 - p0, p2 - p0);
+            return tv.positive();
+        }
+    };
+
+    class Equal_2 {
+    public:
+        bool
+        operator()(const Point_2 &p, const Point_2 &q) const {
+            return p.x() == q.x() && p.y() == q.y();
+        }
+    };
+
+    [[nodiscard]] const Less_xy_2 &
+    less_xy_2_object() const {
+        return _less_xy_2_obj;
+    }
+
+    [[nodiscard]] const Left_turn_2 &
+    left_turn_2_object() const {
+        return _left_turn_2;
+    }
+
+    [[nodiscard]] const Equal_2 &
+    equal_2_object() const {
+        return _equal_2_obj;
+    }
+
+private:
+    Less_xy_2 _less_xy_2_obj;
+    Left_turn_2 _left_turn_2;
+    Equal_2 _equal_2_obj;
+};
+
+}
+
+#endif //CGAL_TUTORIAL_TOY_FRAC_H
@@ -0,0 +1,129 @@
+#ifndef CGAL_TUTORIAL_WIDE_INT_H
+#define CGAL_TUTORIAL_WIDE_INT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// A fixed-width signed integer made of N 64-bit limbs, stored as a sign and a
+// magnitude. It lives entirely on the stack and only provides the handful of
+// operations that the exact Frac predicates need (+, -, * and the sign), so we
+// can evaluate determinants that are too wide for __int128 without reaching
+// for an arbitrary precision library. Results that do not fit in N limbs are
+// silently truncated: callers are expected to pick N from a bound on the
+// operands.
+template <std::size_t N>
+class WideInt {
+public:
+
+    constexpr WideInt() = default;
+
+    constexpr WideInt(__int128 v) {
+        _neg = v < 0;
+        unsigned __int128 m = _neg ? -static_cast<unsigned __int128>(v)
+                                   : static_cast<unsigned __int128>(v);
+        _limbs[0] = static_cast<std::uint64_t>(m);
+        if constexpr (N > 1) {
+            _limbs[1] = static_cast<std::uint64_t>(m >> 64);
+        }
+    }
+
+    // Returns -1, 0 or +1.
+    [[nodiscard]] constexpr int
+    sign() const {
+        for (std::uint64_t limb : _limbs) {
+            if (limb != 0) {
+                return _neg ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    [[nodiscard]] constexpr WideInt
+    operator -() const {
+        WideInt r = *this;
+        r._neg = !_neg;
+        return r;
+    }
+
+    friend constexpr WideInt
+    operator +(const WideInt &a, const WideInt &b) {
+        WideInt r;
+        if (a._neg == b._neg) {
+            add_magnitudes(a, b, r);
+            r._neg = a._neg;
+        } else if (compare_magnitudes(a, b) >= 0) {
+            subtract_magnitudes(a, b, r);
+            r._neg = a._neg;
+        } else {
+            subtract_magnitudes(b, a, r);
+            r._neg = b._neg;
+        }
+        return r;
+    }
+
+    friend constexpr WideInt
+    operator -(const WideInt &a, const WideInt &b) {
+        return a + (-b);
+    }
+
+    // Schoolbook multiplication, keeping the low N limbs.
+    friend constexpr WideInt
+    operator *(const WideInt &a, const WideInt &b) {
+        WideInt r;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (a._limbs[i] == 0) {
+                continue;
+            }
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; i + j < N; ++j) {
+                unsigned __int128 t =
+                    static_cast<unsigned __int128>(a._limbs[i]) * b._limbs[j] +
+                    r._limbs[i + j] + carry;
+                r._limbs[i + j] = static_cast<std::uint64_t>(t);
+                carry = static_cast<std::uint64_t>(t >> 64);
+            }
+        }
+        r._neg = a._neg != b._neg;
+        return r;
+    }
+
+private:
+    std::array<std::uint64_t, N> _limbs{};
+    bool _neg = false;
+
+    static constexpr int
+    compare_magnitudes(const WideInt &a, const WideInt &b) {
+        for (std::size_t i = N; i-- > 0;) {
+            if (a._limbs[i] != b._limbs[i]) {
+                return a._limbs[i] < b._limbs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    static constexpr void
+    add_magnitudes(const WideInt &a, const WideInt &b, WideInt &r) {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            unsigned __int128 t =
+                static_cast<unsigned __int128>(a._limbs[i]) + b._limbs[i] +
+                carry;
+            r._limbs[i] = static_cast<std::uint64_t>(t);
+            carry = static_cast<std::uint64_t>(t >> 64);
+        }
+    }
+
+    // Computes |a| - |b|, assuming |a| >= |b|.
+    static constexpr void
+    subtract_magnitudes(const WideInt &a, const WideInt &b, WideInt &r) {
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            std::uint64_t bi = b._limbs[i] + borrow;
+            borrow = (bi < borrow) || (a._limbs[i] < bi);
+            r._limbs[i] = a._limbs[i] - bi;
+        }
+    }
+};
+
+#endif //CGAL_TUTORIAL_WIDE_INT_H